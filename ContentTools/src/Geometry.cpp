@@ -23,6 +23,12 @@
 #include "Geometry.h"
 #include "Lotus/Util/IOStream.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <thread>
+
 
 using namespace DirectX; // need this to use the overloaded operators
 
@@ -32,34 +38,159 @@ namespace lotus::tools
 namespace
 {
 
-void recalculate_normals(mesh& m)
+constexpr u32 large_mesh_indices  = 3 * 32 * 1024; // meshes with more indices are split into ranges
+constexpr u32 triangles_per_batch = 8 * 1024;
+constexpr u32 indices_per_batch   = 64 * 1024;
+constexpr u32 sources_per_range   = 8 * 1024;
+constexpr f64 weld_step           = math::epsilon; // vertex attributes are rounded to multiples of this before welding
+
+// Calls func(u32 first, u32 last) for consecutive ranges of up to batch_size indices covering [0, count) on up to
+// max_threads threads, the calling one included. The editor can call into the tools from several threads at once, so
+// this starts its own threads rather than going through the engine's job system
+template<typename Func>
+void parallel_for(u32 count, u32 batch_size, u32 max_threads, Func&& func)
+{
+    assert(batch_size && max_threads);
+    const u32 batch_count  = (count + batch_size - 1) / batch_size;
+    const u32 thread_count = std::min(batch_count, max_threads);
+    if (thread_count <= 1)
+    {
+        if (count)
+            func(0u, count);
+        return;
+    }
+
+    std::atomic<u32> next{ 0 };
+    auto             worker = [&]() {
+        for (u32 first = next.fetch_add(batch_size); first < count; first = next.fetch_add(batch_size))
+        {
+            func(first, std::min(first + batch_size, count));
+        }
+    };
+
+    utl::vector<std::thread> threads;
+    threads.reserve(thread_count - 1);
+    for (u32 i = 1; i < thread_count; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+
+    for (u32 i = 0; i < threads.size(); ++i)
+    {
+        threads[i].join();
+    }
+}
+
+// The source vertices (sources[i] is the one of index i) are split into ranges that are processed in parallel by
+// func(u32 first, u32 last, utl::vector<vertex>& vertices). It appends the vertices it makes to its range's list and
+// points the indices of its sources into that list. The lists are then joined in range order and those indices are
+// offset by the vertices of the ranges before, which gives the same result as going through all sources in order
+template<typename Func>
+void build_vertices(mesh& m, const utl::vector<u32>& sources, u32 num_sources, u32 max_threads, Func&& func)
+{
+    assert(m.vertices.empty() && m.indices.size() == sources.size());
+    const u32 num_ranges = (num_sources + sources_per_range - 1) / sources_per_range;
+
+    utl::vector<utl::vector<vertex>> range_vertices(num_ranges);
+    parallel_for(num_ranges, 1, max_threads, [&](u32 first, u32 last) {
+        for (u32 r = first; r < last; ++r)
+        {
+            func(r * sources_per_range, std::min((r + 1) * sources_per_range, num_sources), range_vertices[r]);
+        }
+    });
+
+    utl::vector<u32> offsets(num_ranges);
+    u32              num_vertices = 0;
+    for (u32 r = 0; r < num_ranges; ++r)
+    {
+        offsets[r] = num_vertices;
+        num_vertices += (u32) range_vertices[r].size();
+    }
+
+    m.vertices.resize(num_vertices);
+    for (u32 r = 0; r < num_ranges; ++r)
+    {
+        if (!range_vertices[r].empty())
+            memcpy(&m.vertices[offsets[r]], range_vertices[r].data(), range_vertices[r].size() * sizeof(vertex));
+    }
+
+    if (num_ranges > 1)
+    {
+        parallel_for((u32) m.indices.size(), indices_per_batch, max_threads, [&](u32 first, u32 last) {
+            for (u32 i = first; i < last; ++i)
+            {
+                m.indices[i] += offsets[sources[i] / sources_per_range];
+            }
+        });
+    }
+}
+
+void recalculate_normals(mesh& m, u32 max_threads)
 {
     const u32 num_indices = (u32) m.raw_indices.size();
     m.normals.resize(num_indices);
 
-    for (u32 i = 0; i < num_indices; ++i)
-    {
-        const u32 i0 = m.raw_indices[i];
-        const u32 i1 = m.raw_indices[++i];
-        const u32 i2 = m.raw_indices[++i];
+    parallel_for(num_indices / 3, triangles_per_batch, max_threads, [&m](u32 first, u32 last) {
+        for (u32 t = first; t < last; ++t)
+        {
+            const u32 i  = t * 3;
+            const u32 i0 = m.raw_indices[i];
+            const u32 i1 = m.raw_indices[i + 1];
+            const u32 i2 = m.raw_indices[i + 2];
+
+            const vec v0 = math::load_float3(&m.positions[i0]);
+            const vec v1 = math::load_float3(&m.positions[i1]);
+            const vec v2 = math::load_float3(&m.positions[i2]);
+
+
+            const vec e0 = v1 - v0;
+            const vec e1 = v2 - v0;
 
-        const vec v0 = math::load_float3(&m.positions[i0]);
-        const vec v1 = math::load_float3(&m.positions[i1]);
-        const vec v2 = math::load_float3(&m.positions[i2]);
+            vec n = math::normalize_vec3(math::cross_vec3(e0, e1));
+
+            math::store_float3(&m.normals[i], n);
+            m.normals[i + 1] = m.normals[i];
+            m.normals[i + 2] = m.normals[i];
+        }
+    });
+}
 
+// Corners (positions in the index buffer) of every source vertex in one flat array, in index order. The corners of
+// source v are corners[offsets[v]] up to corners[offsets[v + 1]]
+struct corner_lists
+{
+    utl::vector<u32> offsets;
+    utl::vector<u32> corners;
+};
 
-        const vec e0 = v1 - v0;
-        const vec e1 = v2 - v0;
+void build_corner_lists(const utl::vector<u32>& sources, u32 num_sources, corner_lists& lists)
+{
+    const u32 num_indices = (u32) sources.size();
+    lists.offsets.resize(num_sources + 1, 0);
+    for (u32 i = 0; i < num_indices; ++i)
+    {
+        ++lists.offsets[sources[i] + 1];
+    }
 
-        vec n = math::normalize_vec3(math::cross_vec3(e0, e1));
+    for (u32 v = 0; v < num_sources; ++v)
+    {
+        lists.offsets[v + 1] += lists.offsets[v];
+    }
 
-        math::store_float3(&m.normals[i], n);
-        m.normals[i - 1] = m.normals[i];
-        m.normals[i - 2] = m.normals[i];
+    utl::vector<u32> next(num_sources);
+    memcpy(next.data(), lists.offsets.data(), num_sources * sizeof(u32));
+    lists.corners.resize(num_indices);
+    for (u32 i = 0; i < num_indices; ++i)
+    {
+        lists.corners[next[sources[i]]++] = i;
     }
 }
 
-void process_normals(mesh& m, f32 angle)
+// The first corner of a source that isn't part of a vertex yet starts a new one, and every later corner whose normal is
+// within the smoothing angle of the vertex's normal so far joins it. The corners that don't join are packed to the
+// front in order for the next vertex, so each pass over them is linear
+void process_normals(mesh& m, f32 angle, u32 max_threads)
 {
     const f32  cos_alpha = math::scalar_cos(math::pi - angle * math::pi / 180.0f);
     const bool hard      = math::scalar_near_equal(angle, 180.0f);
@@ -70,27 +201,39 @@ void process_normals(mesh& m, f32 angle)
     assert(num_indices && num_vertices);
     m.indices.resize(num_indices);
 
-    utl::vector<utl::vector<u32>> index_ref(num_vertices);
-    for (u32 i = 0; i < num_indices; ++i)
-    {
-        index_ref[m.raw_indices[i]].emplace_back(i);
-    }
+    corner_lists lists{};
+    build_corner_lists(m.raw_indices, num_vertices, lists);
 
-    for (u32 i = 0; i < num_vertices; ++i)
-    {
-        auto& refs     = index_ref[i];
-        u32   num_refs = (u32) refs.size();
-        for (u32 j = 0; j < num_refs; ++j)
+    build_vertices(m, m.raw_indices, num_vertices, max_threads, [&](u32 first, u32 last, utl::vector<vertex>& vertices) {
+        for (u32 i = first; i < last; ++i)
         {
-            m.indices[refs[j]] = (u32) m.vertices.size();
+            u32* const refs     = &lists.corners[lists.offsets[i]];
+            u32        num_refs = lists.offsets[i + 1] - lists.offsets[i];
+
+            if (hard)
+            {
+                for (u32 j = 0; j < num_refs; ++j)
+                {
+                    m.indices[refs[j]] = (u32) vertices.size();
 
-            vertex& v  = m.vertices.emplace_back();
-            v.position = m.positions[m.raw_indices[refs[j]]];
+                    vertex& v  = vertices.emplace_back();
+                    v.position = m.positions[i];
+                    math::store_float3(&v.normal, math::normalize_vec3(math::load_float3(&m.normals[refs[j]])));
+                }
+                continue;
+            }
 
-            vec n1 = math::load_float3(&m.normals[refs[j]]);
-            if (!hard)
+            while (num_refs)
             {
-                for (u32 k = j + 1; k < num_refs; ++k)
+                const u32 index    = (u32) vertices.size();
+                m.indices[refs[0]] = index;
+
+                vertex& v  = vertices.emplace_back();
+                v.position = m.positions[i];
+
+                vec n1        = math::load_float3(&m.normals[refs[0]]);
+                u32 remaining = 0;
+                for (u32 k = 1; k < num_refs; ++k)
                 {
                     // cos(angle) between normals
                     f32       cos_theta = 0.0f;
@@ -104,19 +247,21 @@ void process_normals(mesh& m, f32 angle)
                     if (soft || cos_theta >= cos_alpha)
                     {
                         n1 += n2;
-                        m.indices[refs[k]] = m.indices[refs[j]];
-                        refs.erase(refs.begin() + k);
-                        --num_refs;
-                        --k;
+                        m.indices[refs[k]] = index;
+                    } else
+                    {
+                        refs[remaining++] = refs[k];
                     }
                 }
+                math::store_float3(&v.normal, math::normalize_vec3(n1));
+                num_refs = remaining;
             }
-            math::store_float3(&v.normal, math::normalize_vec3(n1));
         }
-    }
+    });
 }
 
-void process_uvs(mesh& m)
+// Same as process_normals, a corner joins a vertex if its uv is the same as the uv of the vertex's first corner
+void process_uvs(mesh& m, u32 max_threads)
 {
     utl::vector<vertex> old_verts;
     old_verts.swap(m.vertices);
@@ -127,39 +272,901 @@ void process_uvs(mesh& m)
     const u32 num_indices = (u32) old_indices.size();
     assert(num_verts && num_indices);
 
-    utl::vector<utl::vector<u32>> index_ref(num_verts);
-    for (u32 i = 0; i < num_indices; ++i)
+    corner_lists lists{};
+    build_corner_lists(old_indices, num_verts, lists);
+
+    build_vertices(m, old_indices, num_verts, max_threads, [&](u32 first, u32 last, utl::vector<vertex>& vertices) {
+        for (u32 i = first; i < last; ++i)
+        {
+            u32* const refs     = &lists.corners[lists.offsets[i]];
+            u32        num_refs = lists.offsets[i + 1] - lists.offsets[i];
+
+            while (num_refs)
+            {
+                const u32 index    = (u32) vertices.size();
+                m.indices[refs[0]] = index;
+                vertex& v          = old_verts[i];
+                v.uv               = m.uv_sets[0][refs[0]];
+                vertices.emplace_back(v);
+
+                u32 remaining = 0;
+                for (u32 k = 1; k < num_refs; ++k)
+                {
+                    const vec2& uv1 = m.uv_sets[0][refs[k]];
+                    if (math::scalar_near_equal(v.uv.x, uv1.x) && math::scalar_near_equal(v.uv.y, uv1.y))
+                    {
+                        m.indices[refs[k]] = index;
+                    } else
+                    {
+                        refs[remaining++] = refs[k];
+                    }
+                }
+                num_refs = remaining;
+            }
+        }
+    });
+}
+
+// Every attribute of a vertex rounded to weld_step, so vertices that are the same up to rounding get the same key
+struct weld_key
+{
+    i64 values[16]{};
+    u32 joint_indices[4]{};
+    u32 color{};
+    u32 pad{};
+
+    bool operator==(const weld_key&) const = default;
+};
+
+weld_key make_weld_key(const vertex& v)
+{
+    const f32 floats[16]{ v.tangent.x,       v.tangent.y,       v.tangent.z,       v.tangent.w,
+                          v.joint_weights.x, v.joint_weights.y, v.joint_weights.z, v.joint_weights.w,
+                          v.position.x,      v.position.y,      v.position.z,      v.normal.x,
+                          v.normal.y,        v.normal.z,        v.uv.x,            v.uv.y };
+
+    weld_key key{};
+    for (u32 i = 0; i < 16; ++i)
+    {
+        key.values[i] = (i64) std::floor((f64) floats[i] / weld_step + 0.5);
+    }
+    memcpy(key.joint_indices, &v.joint_indices, sizeof(key.joint_indices));
+    key.color = (u32) v.red | ((u32) v.green << 8) | ((u32) v.blue << 16);
+    return key;
+}
+
+u32 hash_weld_key(const weld_key& key)
+{
+    // FNV-1a over 64 bit words
+    u64 hash = 0xcbf29ce484222325ull;
+    for (const i64 value : key.values)
     {
-        index_ref[old_indices[i]].emplace_back(i);
+        hash = (hash ^ (u64) value) * 0x100000001b3ull;
     }
+    for (const u32 value : key.joint_indices)
+    {
+        hash = (hash ^ value) * 0x100000001b3ull;
+    }
+    hash = (hash ^ key.color) * 0x100000001b3ull;
+    return (u32) (hash ^ (hash >> 32));
+}
 
-    for (u32 i = 0; i < num_verts; ++i)
+// Merges vertices with the same weld key, which process_normals and process_uvs miss when the source data has the same
+// position more than once. One pass over an open addressing table, the first vertex with a key is kept and the vertices
+// keep their order
+void weld_vertices(mesh& m)
+{
+    struct slot
     {
-        auto& refs     = index_ref[i];
-        u32   num_refs = (u32) refs.size();
+        u32 hash{ 0 };
+        u32 vertex{ invalid_id_u32 };
+    };
+
+    const u32 num_vertices = (u32) m.vertices.size();
+    u32       capacity     = 1;
+    while (capacity < num_vertices * 2)
+    {
+        capacity <<= 1;
+    }
 
-        for (u32 j = 0; j < num_refs; ++j)
+    utl::vector<slot> table(capacity);
+    utl::vector<u32>  remap(num_vertices);
+    u32               num_welded = 0;
+    for (u32 v = 0; v < num_vertices; ++v)
+    {
+        const weld_key key  = make_weld_key(m.vertices[v]);
+        const u32      hash = hash_weld_key(key);
+        for (u32 i = hash & (capacity - 1);; i = (i + 1) & (capacity - 1))
         {
-            m.indices[refs[j]] = (u32) m.vertices.size();
-            vertex& v          = old_verts[old_indices[refs[j]]];
-            v.uv               = m.uv_sets[0][refs[j]];
-            m.vertices.emplace_back(v);
+            slot& s = table[i];
+            if (s.vertex == invalid_id_u32)
+            {
+                // Kept vertices are moved down in place, num_welded never passes v
+                s                        = { hash, num_welded };
+                m.vertices[num_welded++] = m.vertices[v];
+                remap[v]                 = s.vertex;
+                break;
+            }
 
-            for (u32 k = j + 1; k < num_refs; ++k)
+            if (s.hash == hash && make_weld_key(m.vertices[s.vertex]) == key)
             {
-                const vec2& uv1 = m.uv_sets[0][refs[k]];
-                if (math::scalar_near_equal(v.uv.x, uv1.x) && math::scalar_near_equal(v.uv.y, uv1.y))
+                remap[v] = s.vertex;
+                break;
+            }
+        }
+    }
+
+    if (num_welded == num_vertices)
+        return;
+
+    m.vertices.resize(num_welded);
+    for (auto& index : m.indices)
+    {
+        index = remap[index];
+    }
+}
+
+constexpr u32 fifo_cache_size   = 16; // used for the stats
+constexpr u32 forsyth_cache_size = 32; // LRU cache the triangle order is scored against
+
+// Shader runs for indices drawn in order through a FIFO cache. Insertion times stand in for the FIFO
+void analyze_vertex_cache(const utl::vector<u32>& indices, u32 num_vertices, f32& acmr, f32& atvr)
+{
+    utl::vector<u32> inserted(num_vertices, invalid_id_u32);
+    u32              misses = 0;
+    for (const u32 index : indices)
+    {
+        if (inserted[index] == invalid_id_u32 || misses - inserted[index] >= fifo_cache_size)
+        {
+            inserted[index] = misses++;
+        }
+    }
+
+    acmr = (f32) misses / (f32) (indices.size() / 3);
+    atvr = (f32) misses / (f32) num_vertices;
+}
+
+// Tom Forsyth's linear-speed vertex cache optimisation. Vertices score higher the more recently they were used and the
+// fewer triangles they have left, and the next triangle is the best scoring one that uses a cached vertex
+class forsyth_optimizer
+{
+public:
+    forsyth_optimizer(const utl::vector<u32>& indices, u32 num_vertices)
+        : m_indices{ indices }, m_num_triangles{ (u32) indices.size() / 3 }, m_live(num_vertices), m_cache_pos(num_vertices),
+          m_vertex_score(num_vertices), m_triangle_score(m_num_triangles), m_emitted(m_num_triangles, 0)
+    {
+        build_corner_lists(indices, num_vertices, m_lists);
+        for (u32 v = 0; v < num_vertices; ++v)
+        {
+            // Corners become triangles, and are removed from the front of the range as triangles are emitted
+            for (u32 i = m_lists.offsets[v]; i < m_lists.offsets[v + 1]; ++i)
+            {
+                m_lists.corners[i] /= 3;
+            }
+            m_live[v]         = m_lists.offsets[v + 1] - m_lists.offsets[v];
+            m_cache_pos[v]    = invalid_id_u32;
+            m_vertex_score[v] = vertex_score(invalid_id_u32, m_live[v]);
+        }
+
+        for (u32 t = 0; t < m_num_triangles; ++t)
+        {
+            m_triangle_score[t] = m_vertex_score[indices[t * 3]] + m_vertex_score[indices[t * 3 + 1]] +
+                                  m_vertex_score[indices[t * 3 + 2]];
+        }
+    }
+
+    void optimize(utl::vector<u32>& result)
+    {
+        result.resize(m_indices.size());
+        u32 cache[forsyth_cache_size + 3];
+        u32 cache_count = 0;
+        u32 next_unused = 0;
+        u32 best        = invalid_id_u32;
+
+        for (u32 n = 0; n < m_num_triangles; ++n)
+        {
+            if (best == invalid_id_u32)
+            {
+                // Nothing in the cache has triangles left, so start over at the first triangle not drawn yet
+                while (m_emitted[next_unused])
+                {
+                    ++next_unused;
+                }
+                best = next_unused;
+            }
+
+            const u32* const tri = &m_indices[best * 3];
+            memcpy(&result[n * 3], tri, 3 * sizeof(u32));
+            m_emitted[best] = 1;
+
+            // The triangle's vertices go to the front, the rest of the cache moves back behind them
+            u32 new_cache[forsyth_cache_size + 3];
+            u32 new_count = 0;
+            for (u32 i = 0; i < 3; ++i)
+            {
+                remove_triangle(tri[i], best);
+                if (new_count == 0 || (tri[i] != new_cache[0] && (new_count == 1 || tri[i] != new_cache[1])))
                 {
-                    m.indices[refs[k]] = m.indices[refs[j]];
-                    refs.erase(refs.begin() + k);
-                    --num_refs;
-                    --k;
+                    new_cache[new_count++] = tri[i];
                 }
             }
+            for (u32 i = 0; i < cache_count; ++i)
+            {
+                const u32 v = cache[i];
+                if (v != tri[0] && v != tri[1] && v != tri[2])
+                {
+                    new_cache[new_count++] = v;
+                }
+            }
+
+            best            = invalid_id_u32;
+            f32 best_score  = -1.0f;
+            for (u32 i = 0; i < new_count; ++i)
+            {
+                const u32 v   = new_cache[i];
+                const u32 pos = i < forsyth_cache_size ? i : invalid_id_u32;
+                m_cache_pos[v] = pos;
+
+                const f32 score = vertex_score(pos, m_live[v]);
+                const f32 delta = score - m_vertex_score[v];
+                m_vertex_score[v] = score;
+
+                for (u32 j = m_lists.offsets[v + 1] - m_live[v]; j < m_lists.offsets[v + 1]; ++j)
+                {
+                    const u32 t = m_lists.corners[j];
+                    m_triangle_score[t] += delta;
+                    if (pos != invalid_id_u32 && m_triangle_score[t] > best_score)
+                    {
+                        best       = t;
+                        best_score = m_triangle_score[t];
+                    }
+                }
+            }
+
+            cache_count = std::min(new_count, forsyth_cache_size);
+            memcpy(cache, new_cache, cache_count * sizeof(u32));
         }
     }
+
+private:
+    static f32 vertex_score(u32 cache_pos, u32 live)
+    {
+        if (!live)
+            return -1.0f;
+
+        f32 score = 0.0f;
+        if (cache_pos < 3)
+        {
+            // The last triangle's vertices score the same so it doesn't matter which order they were drawn in
+            score = 0.75f;
+        } else if (cache_pos < forsyth_cache_size)
+        {
+            score = std::pow(1.0f - (f32) (cache_pos - 3) / (f32) (forsyth_cache_size - 3), 1.5f);
+        }
+
+        // Vertices with few triangles left are finished off so they can leave the cache
+        return score + 2.0f / std::sqrt((f32) live);
+    }
+
+    void remove_triangle(u32 v, u32 t)
+    {
+        u32* const live = &m_lists.corners[m_lists.offsets[v + 1] - m_live[v]];
+        for (u32 i = 0; i < m_live[v]; ++i)
+        {
+            if (live[i] == t)
+            {
+                live[i] = live[0];
+                break;
+            }
+        }
+        --m_live[v];
+    }
+
+    const utl::vector<u32>& m_indices;
+    const u32               m_num_triangles;
+    corner_lists            m_lists;
+    utl::vector<u32>        m_live; // triangles not drawn yet, at the back of the vertex's range
+    utl::vector<u32>        m_cache_pos;
+    utl::vector<f32>        m_vertex_score;
+    utl::vector<f32>        m_triangle_score;
+    utl::vector<u8>         m_emitted;
+};
+
+// Splits the triangles where the cache has to be refilled, since clusters can be moved around there without costing
+// more shader runs, and draws the clusters that face away from the mesh's center first. Those are the most likely to
+// be in front of the rest of the mesh from any direction
+void optimize_overdraw(mesh& m)
+{
+    const u32 num_triangles = (u32) m.indices.size() / 3;
+
+    utl::vector<u32> inserted(m.vertices.size(), invalid_id_u32);
+    utl::vector<u32> cluster_starts;
+    u32              misses = 0;
+    for (u32 t = 0; t < num_triangles; ++t)
+    {
+        u32 triangle_misses = 0;
+        for (u32 i = t * 3; i < t * 3 + 3; ++i)
+        {
+            const u32 index = m.indices[i];
+            if (inserted[index] == invalid_id_u32 || misses - inserted[index] >= fifo_cache_size)
+            {
+                inserted[index] = misses++;
+                ++triangle_misses;
+            }
+        }
+
+        if (triangle_misses == 3)
+        {
+            cluster_starts.emplace_back(t);
+        }
+    }
+
+    const u32 num_clusters = (u32) cluster_starts.size();
+    if (num_clusters < 2)
+        return;
+    cluster_starts.emplace_back(num_triangles);
+
+    // Area weighted centroid and normal of every cluster
+    utl::vector<vec3> centroids(num_clusters);
+    utl::vector<vec3> normals(num_clusters);
+    vec               mesh_centroid = math::set_vector(0.0f, 0.0f, 0.0f, 0.0f);
+    f32               mesh_area     = 0.0f;
+    for (u32 c = 0; c < num_clusters; ++c)
+    {
+        vec centroid = math::set_vector(0.0f, 0.0f, 0.0f, 0.0f);
+        vec normal   = math::set_vector(0.0f, 0.0f, 0.0f, 0.0f);
+        f32 area     = 0.0f;
+        for (u32 t = cluster_starts[c]; t < cluster_starts[c + 1]; ++t)
+        {
+            const vec p0 = math::load_float3(&m.vertices[m.indices[t * 3]].position);
+            const vec p1 = math::load_float3(&m.vertices[m.indices[t * 3 + 1]].position);
+            const vec p2 = math::load_float3(&m.vertices[m.indices[t * 3 + 2]].position);
+            const vec n  = math::cross_vec3(p1 - p0, p2 - p0);
+
+            f32 length_sq = 0.0f;
+            math::store_float(&length_sq, math::dot_vec3(n, n));
+            const f32 length = std::sqrt(length_sq);
+
+            centroid += (p0 + p1 + p2) * (length / 3.0f);
+            normal += n;
+            area += length;
+        }
+
+        mesh_centroid += centroid;
+        mesh_area += area;
+        math::store_float3(&centroids[c], area > 0.0f ? centroid * (1.0f / area) : centroid);
+        math::store_float3(&normals[c], normal);
+    }
+
+    if (mesh_area <= 0.0f)
+        return;
+    mesh_centroid = mesh_centroid * (1.0f / mesh_area);
+
+    utl::vector<f32> keys(num_clusters);
+    utl::vector<u32> order(num_clusters);
+    for (u32 c = 0; c < num_clusters; ++c)
+    {
+        const vec normal = math::load_float3(&normals[c]);
+        f32       length = 0.0f;
+        math::store_float(&length, math::dot_vec3(normal, normal));
+
+        keys[c] = 0.0f;
+        if (length > 0.0f)
+        {
+            math::store_float(&keys[c], math::dot_vec3(math::load_float3(&centroids[c]) - mesh_centroid, normal));
+            keys[c] /= std::sqrt(length);
+        }
+        order[c] = c;
+    }
+
+    std::stable_sort(order.begin(), order.end(), [&keys](u32 a, u32 b) { return keys[a] > keys[b]; });
+
+    utl::vector<u32> old_indices;
+    old_indices.swap(m.indices);
+    m.indices.resize(old_indices.size());
+    u32 n = 0;
+    for (const u32 c : order)
+    {
+        const u32 count = (cluster_starts[c + 1] - cluster_starts[c]) * 3;
+        memcpy(&m.indices[n], &old_indices[cluster_starts[c] * 3], count * sizeof(u32));
+        n += count;
+    }
+}
+
+// Vertices are renumbered in the order they're first drawn so they're fetched front to back
+void reorder_vertices(mesh& m)
+{
+    const u32           num_vertices = (u32) m.vertices.size();
+    utl::vector<u32>    remap(num_vertices, invalid_id_u32);
+    utl::vector<vertex> vertices(num_vertices);
+    u32                 count = 0;
+    for (auto& index : m.indices)
+    {
+        if (remap[index] == invalid_id_u32)
+        {
+            remap[index]      = count;
+            vertices[count++] = m.vertices[index];
+        }
+        index = remap[index];
+    }
+
+    // Vertices no triangle uses are dropped
+    vertices.resize(count);
+    m.vertices.swap(vertices);
 }
 
+void optimize_vertex_order(mesh& m, const geometry_import_settings& settings)
+{
+    const u32 num_vertices = (u32) m.vertices.size();
+    analyze_vertex_cache(m.indices, num_vertices, m.cache_stats.acmr_before, m.cache_stats.atvr_before);
+
+    utl::vector<u32> indices;
+    forsyth_optimizer{ m.indices, num_vertices }.optimize(indices);
+    m.indices.swap(indices);
+
+    if (settings.optimize_overdraw)
+    {
+        optimize_overdraw(m);
+    }
+
+    reorder_vertices(m);
+    analyze_vertex_cache(m.indices, (u32) m.vertices.size(), m.cache_stats.acmr_after, m.cache_stats.atvr_after);
+}
+
+constexpr f32 lod_triangle_ratio = 0.5f;  // each generated LOD aims for this fraction of the previous one's triangles
+constexpr f32 lod_min_reduction  = 0.75f; // a LOD that keeps more of the previous one's triangles ends the chain
+constexpr u32 lod_min_triangles  = 64;    // no LOD is made from one with fewer triangles
+constexpr f32 lod_error_ratio    = 1.0f / 1024.0f; // error over distance where a LOD is switched to, about a pixel at 1080p
+constexpr f64 border_weight      = 10.0;  // makes moving a border away from where it was much more costly
+
+// Sum of squared distances to a set of planes, weighted by area (Garland and Heckbert)
+struct quadric
+{
+    f64 a2{}, ab{}, ac{}, ad{}, b2{}, bc{}, bd{}, c2{}, cd{}, d2{};
+    f64 weight{};
+
+    void add_plane(f64 a, f64 b, f64 c, f64 d, f64 w)
+    {
+        a2 += a * a * w;
+        ab += a * b * w;
+        ac += a * c * w;
+        ad += a * d * w;
+        b2 += b * b * w;
+        bc += b * c * w;
+        bd += b * d * w;
+        c2 += c * c * w;
+        cd += c * d * w;
+        d2 += d * d * w;
+        weight += w;
+    }
+
+    void add(const quadric& q)
+    {
+        a2 += q.a2;
+        ab += q.ab;
+        ac += q.ac;
+        ad += q.ad;
+        b2 += q.b2;
+        bc += q.bc;
+        bd += q.bd;
+        c2 += q.c2;
+        cd += q.cd;
+        d2 += q.d2;
+        weight += q.weight;
+    }
+
+    [[nodiscard]] f64 error(const vec3& p) const
+    {
+        const f64 x = p.x;
+        const f64 y = p.y;
+        const f64 z = p.z;
+        const f64 e = a2 * x * x + b2 * y * y + c2 * z * z + 2.0 * (ab * x * y + ac * x * z + bc * y * z) +
+                      2.0 * (ad * x + bd * y + cd * z) + d2;
+        return std::max(e, 0.0);
+    }
+};
+
+// Quadric error edge collapse. A vertex is only ever collapsed onto a neighbor, so no new vertices are made and the ones
+// that are kept keep their normals and uvs. Positions with more than one vertex are seams in normals or uvs and never
+// move, and border vertices only move along their border. Each pass sorts every possible collapse by error and takes
+// the cheapest ones that don't touch the one-ring of a vertex collapsed earlier in the pass
+class mesh_simplifier
+{
+public:
+    explicit mesh_simplifier(const mesh& m) : m_vertices{ m.vertices }, m_remap(m.vertices.size())
+    {
+        find_positions();
+
+        // Triangles with no area in position space are dropped up front
+        for (u32 t = 0; t < m.indices.size() / 3; ++t)
+        {
+            const u32 p0 = m_position[m.indices[t * 3]];
+            const u32 p1 = m_position[m.indices[t * 3 + 1]];
+            const u32 p2 = m_position[m.indices[t * 3 + 2]];
+            if (p0 != p1 && p1 != p2 && p2 != p0)
+            {
+                for (u32 i = t * 3; i < t * 3 + 3; ++i)
+                {
+                    m_indices.emplace_back(m.indices[i]);
+                }
+            }
+        }
+
+        classify_positions();
+        build_quadrics();
+    }
+
+    // Collapses edges until there are no more than target triangles or nothing can be collapsed. Returns the largest
+    // distance error of a collapse that was made
+    f32 simplify(u32 target, utl::vector<u32>& indices)
+    {
+        const u32 num_vertices = (u32) m_vertices.size();
+        f64       max_error    = 0.0;
+
+        while (m_indices.size() / 3 > target)
+        {
+            utl::vector<collapse> collapses;
+            find_collapses(collapses);
+            std::sort(collapses.begin(), collapses.end(), [](const collapse& a, const collapse& b) {
+                return a.cost < b.cost || (a.cost == b.cost && (a.from < b.from || (a.from == b.from && a.to < b.to)));
+            });
+
+            corner_lists lists{};
+            build_corner_lists(m_indices, num_vertices, lists);
+            utl::vector<u8> touched(num_vertices, 0);
+            for (u32 v = 0; v < num_vertices; ++v)
+            {
+                m_remap[v] = v;
+            }
+
+            const u32 needed  = (u32) m_indices.size() / 3 - target;
+            u32       removed = 0;
+            for (const collapse& c : collapses)
+            {
+                if (removed >= needed)
+                    break;
+
+                if (touched[c.from] || touched[c.to] || flips(lists, c.from, c.to))
+                    continue;
+
+                for (u32 i = lists.offsets[c.from]; i < lists.offsets[c.from + 1]; ++i)
+                {
+                    const u32* const tri = &m_indices[lists.corners[i] / 3 * 3];
+                    removed += m_position[tri[0]] == m_position[c.to] || m_position[tri[1]] == m_position[c.to] ||
+                               m_position[tri[2]] == m_position[c.to];
+                    touched[tri[0]] = touched[tri[1]] = touched[tri[2]] = 1;
+                }
+
+                const u32 from = m_position[c.from];
+                const u32 to   = m_position[c.to];
+                m_quadrics[to].add(m_quadrics[from]);
+                max_error = std::max(max_error, c.cost / std::max(m_quadrics[to].weight, 1e-12));
+                if (m_kind[from] == kind::border)
+                {
+                    move_border(from, to);
+                }
+                m_remap[c.from] = c.to;
+            }
+
+            if (!removed)
+                break;
+
+            // Collapsed vertices are replaced and triangles that lost their area are dropped
+            u32 count = 0;
+            for (u32 t = 0; t < m_indices.size() / 3; ++t)
+            {
+                const u32 v0 = m_remap[m_indices[t * 3]];
+                const u32 v1 = m_remap[m_indices[t * 3 + 1]];
+                const u32 v2 = m_remap[m_indices[t * 3 + 2]];
+                if (m_position[v0] != m_position[v1] && m_position[v1] != m_position[v2] &&
+                    m_position[v2] != m_position[v0])
+                {
+                    m_indices[count++] = v0;
+                    m_indices[count++] = v1;
+                    m_indices[count++] = v2;
+                }
+            }
+            m_indices.resize(count);
+        }
+
+        indices.swap(m_indices);
+        return (f32) std::sqrt(max_error);
+    }
+
+private:
+    struct kind
+    {
+        enum type : u8
+        {
+            interior,
+            border,
+            locked,
+        };
+    };
+
+    struct collapse
+    {
+        f64 cost;
+        u32 from;
+        u32 to;
+    };
+
+    // Vertices at the same position get the same position id
+    void find_positions()
+    {
+        const u32        num_vertices = (u32) m_vertices.size();
+        utl::vector<u32> order(num_vertices);
+        for (u32 v = 0; v < num_vertices; ++v)
+        {
+            order[v] = v;
+        }
+
+        const auto less = [this](u32 a, u32 b) {
+            const vec3& pa = m_vertices[a].position;
+            const vec3& pb = m_vertices[b].position;
+            return pa.x < pb.x || (pa.x == pb.x && (pa.y < pb.y || (pa.y == pb.y && pa.z < pb.z)));
+        };
+        std::sort(order.begin(), order.end(), less);
+
+        m_position.resize(num_vertices);
+        u32 num_positions = 0;
+        for (u32 i = 0; i < num_vertices; ++i)
+        {
+            if (i > 0 && less(order[i - 1], order[i]))
+            {
+                ++num_positions;
+            }
+            m_position[order[i]] = num_positions;
+        }
+        m_num_positions = num_vertices ? num_positions + 1 : 0;
+    }
+
+    // Edges are counted in position space so uv and normal seams don't look like borders. Positions with more than one
+    // vertex, on an edge shared by more than two triangles, or where borders meet are locked
+    void classify_positions()
+    {
+        struct edge
+        {
+            u64 key;
+            u32 triangle;
+        };
+
+        const u32         num_triangles = (u32) m_indices.size() / 3;
+        utl::vector<edge> edges(num_triangles * 3);
+        for (u32 t = 0; t < num_triangles; ++t)
+        {
+            for (u32 k = 0; k < 3; ++k)
+            {
+                const u32 a      = m_position[m_indices[t * 3 + k]];
+                const u32 b      = m_position[m_indices[t * 3 + (k + 1) % 3]];
+                edges[t * 3 + k] = { ((u64) std::min(a, b) << 32) | std::max(a, b), t };
+            }
+        }
+        std::sort(edges.begin(), edges.end(), [](const edge& a, const edge& b) {
+            return a.key < b.key || (a.key == b.key && a.triangle < b.triangle);
+        });
+
+        utl::vector<u32> vertex_count(m_num_positions, 0);
+        for (u32 p : m_position)
+        {
+            ++vertex_count[p];
+        }
+
+        utl::vector<u8> locked(m_num_positions, 0);
+        m_border.resize(m_num_positions * 2, invalid_id_u32);
+        utl::vector<u32> border_count(m_num_positions, 0);
+        for (u32 i = 0; i < edges.size();)
+        {
+            u32 run = 1;
+            while (i + run < edges.size() && edges[i + run].key == edges[i].key)
+            {
+                ++run;
+            }
+
+            const u32 a = (u32) (edges[i].key >> 32);
+            const u32 b = (u32) edges[i].key;
+            if (run > 2)
+            {
+                locked[a] = locked[b] = 1;
+            } else if (run == 1)
+            {
+                for (const auto& [p, other] : { std::pair{ a, b }, std::pair{ b, a } })
+                {
+                    if (border_count[p] < 2)
+                    {
+                        m_border[p * 2 + border_count[p]] = other;
+                    }
+                    ++border_count[p];
+                }
+                m_border_edges.emplace_back(edges[i].triangle);
+                m_border_edges.emplace_back(a);
+                m_border_edges.emplace_back(b);
+            }
+            i += run;
+        }
+
+        m_kind.resize(m_num_positions);
+        for (u32 p = 0; p < m_num_positions; ++p)
+        {
+            if (locked[p] || vertex_count[p] > 1 || (border_count[p] && border_count[p] != 2))
+            {
+                m_kind[p] = kind::locked;
+            } else
+            {
+                m_kind[p] = border_count[p] ? kind::border : kind::interior;
+            }
+        }
+    }
+
+    void build_quadrics()
+    {
+        m_quadrics.resize(m_num_positions);
+        utl::vector<vec3> positions(m_num_positions);
+        for (u32 v = 0; v < m_vertices.size(); ++v)
+        {
+            positions[m_position[v]] = m_vertices[v].position;
+        }
+
+        const u32 num_triangles = (u32) m_indices.size() / 3;
+        for (u32 t = 0; t < num_triangles; ++t)
+        {
+            const u32 p[3]{ m_position[m_indices[t * 3]], m_position[m_indices[t * 3 + 1]],
+                            m_position[m_indices[t * 3 + 2]] };
+            f64 a, b, c, d, area;
+            if (!plane(positions[p[0]], positions[p[1]], positions[p[2]], a, b, c, d, area))
+                continue;
+
+            for (const u32 i : p)
+            {
+                m_quadrics[i].add_plane(a, b, c, d, area);
+            }
+        }
+
+        // A plane through each border edge at a right angle to its triangle keeps the border where it is
+        for (u32 i = 0; i < m_border_edges.size(); i += 3)
+        {
+            const u32 t = m_border_edges[i];
+            f64       a, b, c, d, area;
+            if (!plane(m_vertices[m_indices[t * 3]].position, m_vertices[m_indices[t * 3 + 1]].position,
+                       m_vertices[m_indices[t * 3 + 2]].position, a, b, c, d, area))
+                continue;
+
+            const vec3& p0 = positions[m_border_edges[i + 1]];
+            const vec3& p1 = positions[m_border_edges[i + 2]];
+            const f64   ex = (f64) p1.x - p0.x;
+            const f64   ey = (f64) p1.y - p0.y;
+            const f64   ez = (f64) p1.z - p0.z;
+            f64         nx = ey * c - ez * b;
+            f64         ny = ez * a - ex * c;
+            f64         nz = ex * b - ey * a;
+            const f64   length = std::sqrt(nx * nx + ny * ny + nz * nz);
+            if (length <= 0.0)
+                continue;
+
+            nx /= length;
+            ny /= length;
+            nz /= length;
+            const f64 nd     = -(nx * p0.x + ny * p0.y + nz * p0.z);
+            const f64 weight = (ex * ex + ey * ey + ez * ez) * border_weight;
+            m_quadrics[m_border_edges[i + 1]].add_plane(nx, ny, nz, nd, weight);
+            m_quadrics[m_border_edges[i + 2]].add_plane(nx, ny, nz, nd, weight);
+        }
+    }
+
+    static bool plane(const vec3& p0, const vec3& p1, const vec3& p2, f64& a, f64& b, f64& c, f64& d, f64& area)
+    {
+        const f64 e0[3]{ (f64) p1.x - p0.x, (f64) p1.y - p0.y, (f64) p1.z - p0.z };
+        const f64 e1[3]{ (f64) p2.x - p0.x, (f64) p2.y - p0.y, (f64) p2.z - p0.z };
+        a                = e0[1] * e1[2] - e0[2] * e1[1];
+        b                = e0[2] * e1[0] - e0[0] * e1[2];
+        c                = e0[0] * e1[1] - e0[1] * e1[0];
+        const f64 length = std::sqrt(a * a + b * b + c * c);
+        if (length <= 0.0)
+            return false;
+
+        a /= length;
+        b /= length;
+        c /= length;
+        d    = -(a * p0.x + b * p0.y + c * p0.z);
+        area = length * 0.5;
+        return true;
+    }
+
+    [[nodiscard]] bool can_collapse(u32 from, u32 to) const
+    {
+        const u32 p = m_position[from];
+        if (m_kind[p] == kind::locked)
+            return false;
+
+        return m_kind[p] == kind::interior || m_border[p * 2] == m_position[to] || m_border[p * 2 + 1] == m_position[to];
+    }
+
+    void find_collapses(utl::vector<collapse>& collapses) const
+    {
+        const u32 num_triangles = (u32) m_indices.size() / 3;
+        collapses.reserve(num_triangles * 3);
+        for (u32 i = 0; i < num_triangles * 3; ++i)
+        {
+            const u32 a = m_indices[i];
+            const u32 b = m_indices[i - i % 3 + (i % 3 + 1) % 3];
+
+            collapse best{ -1.0, 0, 0 };
+            for (const auto& [from, to] : { std::pair{ a, b }, std::pair{ b, a } })
+            {
+                if (!can_collapse(from, to))
+                    continue;
+
+                quadric q = m_quadrics[m_position[from]];
+                q.add(m_quadrics[m_position[to]]);
+                const f64 cost = q.error(m_vertices[to].position);
+                if (best.cost < 0.0 || cost < best.cost)
+                {
+                    best = { cost, from, to };
+                }
+            }
+
+            if (best.cost >= 0.0)
+            {
+                collapses.emplace_back(best);
+            }
+        }
+    }
+
+    // True if moving from to the position of to turns one of from's triangles by more than about 75 degrees
+    [[nodiscard]] bool flips(const corner_lists& lists, u32 from, u32 to) const
+    {
+        const vec p_to = math::load_float3(&m_vertices[to].position);
+        for (u32 i = lists.offsets[from]; i < lists.offsets[from + 1]; ++i)
+        {
+            const u32        corner = lists.corners[i];
+            const u32* const tri    = &m_indices[corner - corner % 3];
+            if (m_position[tri[0]] == m_position[to] || m_position[tri[1]] == m_position[to] ||
+                m_position[tri[2]] == m_position[to])
+                continue;
+
+            vec p[3]{ math::load_float3(&m_vertices[tri[0]].position), math::load_float3(&m_vertices[tri[1]].position),
+                      math::load_float3(&m_vertices[tri[2]].position) };
+            const vec n0 = math::cross_vec3(p[1] - p[0], p[2] - p[0]);
+            p[corner % 3] = p_to;
+            const vec n1  = math::cross_vec3(p[1] - p[0], p[2] - p[0]);
+
+            f32 dot = 0.0f, length0 = 0.0f, length1 = 0.0f;
+            math::store_float(&dot, math::dot_vec3(n0, n1));
+            math::store_float(&length0, math::dot_vec3(n0, n0));
+            math::store_float(&length1, math::dot_vec3(n1, n1));
+            if (dot <= 0.0f || dot * dot < 0.0625f * length0 * length1)
+                return true;
+        }
+        return false;
+    }
+
+    // from's other border neighbor and to become neighbors
+    void move_border(u32 from, u32 to)
+    {
+        const auto replace = [this](u32 p, u32 old, u32 now) {
+            if (m_kind[p] != kind::border)
+                return;
+
+            u32* const border                = &m_border[p * 2];
+            border[border[0] == old ? 0 : 1] = now;
+        };
+
+        const u32 other = m_border[from * 2] == to ? m_border[from * 2 + 1] : m_border[from * 2];
+        replace(to, from, other);
+        replace(other, from, to);
+    }
+
+    const utl::vector<vertex>& m_vertices;
+    utl::vector<u32>           m_indices;
+    utl::vector<u32>           m_position; // position id of each vertex
+    u32                        m_num_positions{ 0 };
+    utl::vector<kind::type>    m_kind;     // per position
+    utl::vector<u32>           m_border;   // the two border neighbors of each border position
+    utl::vector<u32>           m_border_edges; // triangle and the two positions of every border edge
+    utl::vector<quadric>       m_quadrics; // per position
+    utl::vector<u32>           m_remap;
+};
+
 u64 get_vertex_element_size(elements::elements_type::type elements_type)
 {
     using namespace elements;
@@ -438,22 +1445,33 @@ void determine_elements_type(mesh& m)
 }
 
 
-void process_vertices(mesh& m, const geometry_import_settings& settings)
+void process_vertices(mesh& m, const geometry_import_settings& settings, u32 max_threads)
 {
     assert(m.raw_indices.size() % 3 == 0);
     if (settings.calculate_normals || m.normals.empty())
     {
-        recalculate_normals(m);
+        recalculate_normals(m, max_threads);
     }
 
-    process_normals(m, settings.smoothing_angle);
+    process_normals(m, settings.smoothing_angle, max_threads);
 
     if (!m.uv_sets.empty())
     {
-        process_uvs(m);
+        process_uvs(m, max_threads);
     }
 
+    weld_vertices(m);
     determine_elements_type(m);
+}
+
+// LODs are made between process_vertices and this
+void finish_vertices(mesh& m, const geometry_import_settings& settings)
+{
+    if (settings.optimize_vertex_cache)
+    {
+        optimize_vertex_order(m, settings);
+    }
+
     pack_vertices(m);
 }
 
@@ -606,46 +1624,238 @@ bool split_meshes_by_material(u32 mtl_idx, const mesh& m, mesh& submesh)
     return !submesh.raw_indices.empty();
 }
 
-void split_meshes_by_material(scene& scene)
+// Submeshes are made in parallel into slots laid out in the order the serial loop made them. Materials without
+// polygons leave their slot unused
+void split_meshes_by_material(scene& scene, u32 max_threads)
 {
-    for (auto& [name, meshes] : scene.lod_groups)
+    struct split
     {
-        utl::vector<mesh> new_meshes;
+        u32 lod;
+        u32 mesh;
+        u32 material; // invalid_id_u32 if the mesh is kept whole
+    };
 
-        for (auto& m : meshes)
+    utl::vector<split> splits;
+    for (u32 lod = 0; lod < scene.lod_groups.size(); ++lod)
+    {
+        const utl::vector<mesh>& meshes = scene.lod_groups[lod].meshes;
+        for (u32 i = 0; i < meshes.size(); ++i)
         {
-            const u32 num_materials = (u32) m.material_used.size();
+            const u32 num_materials = (u32) meshes[i].material_used.size();
             if (num_materials > 1)
             {
-                for (u32 i = 0; i < num_materials; ++i)
+                for (u32 j = 0; j < num_materials; ++j)
                 {
-                    if (mesh submesh{}; split_meshes_by_material(m.material_used[i], m, submesh))
-                    {
-                        new_meshes.emplace_back(submesh);
-                    }
+                    splits.emplace_back(split{ lod, i, meshes[i].material_used[j] });
                 }
             } else
             {
-                new_meshes.emplace_back(m);
+                splits.emplace_back(split{ lod, i, invalid_id_u32 });
+            }
+        }
+    }
+
+    utl::vector<mesh> new_meshes(splits.size());
+    utl::vector<u8>   used(splits.size());
+    parallel_for((u32) splits.size(), 1, max_threads, [&](u32 first, u32 last) {
+        for (u32 i = first; i < last; ++i)
+        {
+            mesh& m = scene.lod_groups[splits[i].lod].meshes[splits[i].mesh];
+            if (splits[i].material == invalid_id_u32)
+            {
+                new_meshes[i] = std::move(m);
+                used[i]       = 1;
+            } else
+            {
+                used[i] = split_meshes_by_material(splits[i].material, m, new_meshes[i]);
             }
         }
+    });
+
+    for (u32 lod = 0; lod < scene.lod_groups.size(); ++lod)
+    {
+        scene.lod_groups[lod].meshes.clear();
+    }
 
-        new_meshes.swap(meshes);
+    for (u32 i = 0; i < splits.size(); ++i)
+    {
+        if (used[i])
+        {
+            scene.lod_groups[splits[i].lod].meshes.emplace_back(std::move(new_meshes[i]));
+        }
     }
 }
 
+// Groups without LODs of their own get up to settings.generated_lods more, each made by simplifying the one before
+// it. A LOD is switched to from the distance where its error is about a pixel
+void generate_lods(scene& scene, const geometry_import_settings& settings, u32 max_threads)
+{
+    for (auto& group : scene.lod_groups)
+    {
+        const u32 num_submeshes = (u32) group.meshes.size();
+        if (!num_submeshes || std::any_of(group.meshes.begin(), group.meshes.end(),
+                                          [&group](const mesh& m) { return m.lod_id != group.meshes[0].lod_id; }))
+            continue;
+
+        f32 error     = 0.0f;
+        f32 threshold = 0.0f;
+        for (u32 level = 1; level <= settings.generated_lods; ++level)
+        {
+            const u32 first         = (level - 1) * num_submeshes;
+            u32       num_triangles = 0;
+            for (u32 i = first; i < first + num_submeshes; ++i)
+            {
+                num_triangles += (u32) group.meshes[i].indices.size() / 3;
+            }
+
+            if (num_triangles < lod_min_triangles)
+                break;
+
+            utl::vector<mesh> lods(num_submeshes);
+            utl::vector<f32>  errors(num_submeshes);
+            parallel_for(num_submeshes, 1, max_threads, [&](u32 begin, u32 end) {
+                for (u32 i = begin; i < end; ++i)
+                {
+                    const mesh& source = group.meshes[first + i];
+                    mesh&       lod    = lods[i];
+                    const u32   target = (u32) ((f32) (source.indices.size() / 3) * lod_triangle_ratio);
+                    errors[i]          = mesh_simplifier{ source }.simplify(target, lod.indices);
+
+                    lod.vertices = source.vertices;
+                    reorder_vertices(lod);
+                    lod.name          = group.meshes[i].name + "_lod" + std::to_string(level);
+                    lod.elements_type = source.elements_type;
+                    lod.lod_id        = level;
+                }
+            });
+
+            u32 lod_triangles = 0;
+            for (const auto& lod : lods)
+            {
+                lod_triangles += (u32) lod.indices.size() / 3;
+            }
+
+            if (lod_triangles > (u32) ((f32) num_triangles * lod_min_reduction) ||
+                std::any_of(lods.begin(), lods.end(), [](const mesh& m) { return m.indices.empty(); }))
+                break;
+
+            // Primitives leave their lod_id unset
+            for (u32 i = 0; level == 1 && i < num_submeshes; ++i)
+            {
+                group.meshes[i].lod_id = 0;
+            }
+
+            // Errors add up since each LOD is made from the one before. Thresholds have to go up from one LOD to the next
+            error += *std::max_element(errors.begin(), errors.end());
+            threshold = std::max(error / lod_error_ratio, std::nextafter(threshold, FLT_MAX));
+            for (auto& lod : lods)
+            {
+                lod.lod_threshold = threshold;
+                group.meshes.emplace_back(std::move(lod));
+            }
+        }
+    }
+}
+
+// Shader runs and vertices of each mesh are added up, so big meshes count for more than small ones
+vertex_cache_stats scene_cache_stats(const scene& scene)
+{
+    f64 runs_before     = 0.0;
+    f64 runs_after      = 0.0;
+    f64 vertices_before = 0.0;
+    f64 vertices_after  = 0.0;
+    f64 triangles       = 0.0;
+    for (const auto& group : scene.lod_groups)
+    {
+        for (const auto& m : group.meshes)
+        {
+            const vertex_cache_stats& stats = m.cache_stats;
+            if (stats.atvr_before <= 0.0f || stats.atvr_after <= 0.0f)
+                continue;
+
+            const f64 num_triangles = (f64) m.indices.size() / 3;
+            const f64 before        = stats.acmr_before * num_triangles;
+            const f64 after         = stats.acmr_after * num_triangles;
+            runs_before += before;
+            runs_after += after;
+            vertices_before += before / stats.atvr_before;
+            vertices_after += after / stats.atvr_after;
+            triangles += num_triangles;
+        }
+    }
+
+    vertex_cache_stats stats{};
+    if (triangles > 0.0)
+    {
+        stats.acmr_before = (f32) (runs_before / triangles);
+        stats.atvr_before = (f32) (runs_before / vertices_before);
+        stats.acmr_after  = (f32) (runs_after / triangles);
+        stats.atvr_after  = (f32) (runs_after / vertices_after);
+    }
+    return stats;
+}
+
 } // anonymous namespace
 
-void process_scene(scene& scene, const geometry_import_settings& settings)
+void process_scene(scene& scene, const geometry_import_settings& settings, u32 max_threads)
 {
-    split_meshes_by_material(scene);
+    if (!max_threads)
+    {
+        max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    split_meshes_by_material(scene, max_threads);
+
+    // Meshes are independent, so small ones are processed whole on one thread each, biggest first so the last ones to
+    // finish are short. Large meshes are processed one after another with their triangles and vertices spread over
+    // all threads
+    utl::vector<mesh*> small_meshes;
+    utl::vector<mesh*> large_meshes;
     for (auto& [name, meshes] : scene.lod_groups)
     {
         for (auto& m : meshes)
         {
-            process_vertices(m, settings);
+            (m.raw_indices.size() >= large_mesh_indices ? large_meshes : small_meshes).emplace_back(&m);
         }
     }
+
+    std::sort(small_meshes.begin(), small_meshes.end(),
+              [](const mesh* a, const mesh* b) { return a->raw_indices.size() > b->raw_indices.size(); });
+    parallel_for((u32) small_meshes.size(), 1, max_threads, [&](u32 first, u32 last) {
+        for (u32 i = first; i < last; ++i)
+        {
+            process_vertices(*small_meshes[i], settings, 1);
+        }
+    });
+
+    for (u32 i = 0; i < large_meshes.size(); ++i)
+    {
+        process_vertices(*large_meshes[i], settings, max_threads);
+    }
+
+    if (settings.generated_lods)
+    {
+        generate_lods(scene, settings, max_threads);
+    }
+
+    // What's left is done whole on one thread per mesh, LODs included
+    utl::vector<mesh*> all_meshes;
+    for (auto& [name, meshes] : scene.lod_groups)
+    {
+        for (auto& m : meshes)
+        {
+            all_meshes.emplace_back(&m);
+        }
+    }
+
+    std::sort(all_meshes.begin(), all_meshes.end(),
+              [](const mesh* a, const mesh* b) { return a->indices.size() > b->indices.size(); });
+    parallel_for((u32) all_meshes.size(), 1, max_threads, [&](u32 first, u32 last) {
+        for (u32 i = first; i < last; ++i)
+        {
+            finish_vertices(*all_meshes[i], settings);
+        }
+    });
 }
 
 
@@ -656,6 +1866,7 @@ void pack_data(const scene& scene, scene_data& data)
     data.buffer_size         = (u32) scene_size;
     data.buffer              = (u8*) CoTaskMemAlloc(scene_size);
     assert(data.buffer);
+    data.cache_stats = scene_cache_stats(scene);
 
     utl::blob_stream_writer blob(data.buffer, data.buffer_size);
 
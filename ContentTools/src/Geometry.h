@@ -142,6 +142,16 @@ struct skeletal_normal_texture_color
 
 } // namespace elements
 
+// ACMR is vertex shader runs per triangle and ATVR runs per vertex, simulated with a 16 entry FIFO post-transform cache.
+// ATVR is 1.0 at best, ACMR 0.5 for a regular grid
+struct vertex_cache_stats
+{
+    f32 acmr_before{ 0.0f };
+    f32 atvr_before{ 0.0f };
+    f32 acmr_after{ 0.0f };
+    f32 atvr_after{ 0.0f };
+};
+
 struct mesh
 {
     utl::vector<vec3> positions;
@@ -165,6 +175,7 @@ struct mesh
     elements::elements_type::type elements_type;
     utl::vector<u8>               position_buffer;
     utl::vector<u8>               element_buffer;
+    vertex_cache_stats            cache_stats; // only set when optimize_vertex_cache is on
 
     f32 lod_threshold = -1.0f;
     u32 lod_id{ invalid_id_u32 };
@@ -190,6 +201,9 @@ struct geometry_import_settings
     u8  reverse_handedness;
     u8  import_embeded_textures;
     u8  import_animations;
+    u8  optimize_vertex_cache; // reorder triangles for the post-transform cache, then vertices by first use
+    u8  optimize_overdraw;     // also draw outward facing clusters first, needs optimize_vertex_cache
+    u8  generated_lods;        // LODs made by mesh simplification for groups that don't have any
 };
 
 struct scene_data
@@ -198,9 +212,13 @@ struct scene_data
     u32 buffer_size;
 
     geometry_import_settings settings;
+    // Over every mesh of the scene that was optimized for the vertex cache, zero if none was
+    vertex_cache_stats cache_stats;
 };
 
-void process_scene(scene& scene, const geometry_import_settings& settings);
+// Meshes, and ranges of large meshes, are processed on up to max_threads threads, 0 uses one per core. The result doesn't
+// depend on the thread count
+void process_scene(scene& scene, const geometry_import_settings& settings, u32 max_threads = 0);
 void pack_data(const scene& scene, scene_data& data);
 
 } // namespace lotus::tools
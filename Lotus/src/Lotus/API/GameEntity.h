@@ -25,6 +25,8 @@
 #include "TransformComponent.h"
 #include "ScriptComponent.h"
 
+#include <coroutine>
+
 namespace lotus
 {
 namespace game_entity
@@ -56,6 +58,45 @@ class entity
 
 namespace script
 {
+constexpr u32 max_update_interval{ 64 };
+
+// How often the scripts of a type are updated. A type declares it with a constexpr static update_policy member called
+// policy, types without one are updated every frame. The engine staggers scripts that skip frames so about as many are
+// updated each frame, and update is passed the time since the script's previous update.
+// Scripts are updated on the main thread unless their type opts into parallel updates. Those scripts are updated on the
+// job system's threads and may only read shared state and move their own entity through set_rotation, set_position and
+// the like. Creating or removing entities and scripts, and changing parents, is only allowed on the main thread
+struct update_policy
+{
+    enum mode : u8
+    {
+        every_frame,
+        every_n_frames,
+        distance, // from the active camera, see script::set_active_camera
+    };
+
+    mode kind{ every_frame };
+    u32  interval{ 1 };         // every_n_frames: frames between updates. distance: the most, a power of two
+    f32  near_distance{ 0.0f }; // distance: every frame up to here
+    f32  far_distance{ 0.0f };  // distance: every interval frames from here on, the interval doubles in steps between
+    bool parallel{ false };     // update may run on the job system's threads, see above
+
+    [[nodiscard]] constexpr static update_policy every(u32 frames) { return { every_n_frames, frames }; }
+
+    [[nodiscard]] constexpr static update_policy by_distance(f32 near_distance, f32 far_distance, u32 max_interval)
+    {
+        return { distance, max_interval, near_distance, far_distance };
+    }
+
+    // The same policy for a type whose update only moves its own entity
+    [[nodiscard]] constexpr update_policy in_parallel() const
+    {
+        update_policy policy{ *this };
+        policy.parallel = true;
+        return policy;
+    }
+};
+
 class entity_script : public game_entity::entity
 {
 public:
@@ -78,21 +119,170 @@ class entity_script : public game_entity::entity
     static void set_scale(const entity* const entity, vec3 scale);
 };
 
+// Return type of coroutine_script::run. Owns the coroutine until the script system takes it over
+class task
+{
+public:
+    struct promise_type
+    {
+        u32 slot{ invalid_id_u32 }; // set by the script system when it takes the coroutine over
+
+        task                get_return_object() { return task{ std::coroutine_handle<promise_type>::from_promise(*this) }; }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void                return_void() {}
+        void                unhandled_exception() { std::terminate(); }
+
+        // Coroutine frames count towards the script memory
+        static void* operator new(size_t size)
+        {
+            return utl::tracking_allocator<utl::memory_tag::scripts>::reallocate(nullptr, 0, size);
+        }
+        static void operator delete(void* frame, size_t size)
+        {
+            utl::tracking_allocator<utl::memory_tag::scripts>::deallocate(frame, size);
+        }
+    };
+
+    using handle = std::coroutine_handle<promise_type>;
+
+    task() = default;
+    explicit task(handle h) : m_handle{ h } {}
+    DISABLE_COPY(task);
+    task(task&& o) noexcept : m_handle{ std::exchange(o.m_handle, {}) } {}
+    task& operator=(task&& o) noexcept
+    {
+        if (this != std::addressof(o))
+        {
+            if (m_handle)
+                m_handle.destroy();
+            m_handle = std::exchange(o.m_handle, {});
+        }
+        return *this;
+    }
+    ~task()
+    {
+        if (m_handle)
+            m_handle.destroy();
+    }
+
+    [[nodiscard]] handle release() { return std::exchange(m_handle, {}); }
+
+private:
+    handle m_handle{};
+};
+
+// A script written as a coroutine instead of being updated every frame. run starts in the first update_all after the
+// script is created and the coroutine is only resumed when what it awaits is due, so a waiting script costs nothing
+class coroutine_script : public entity_script
+{
+public:
+    virtual task run() = 0;
+
+    void update([[maybe_unused]] f32 delta) final {}
+
+protected:
+    constexpr explicit coroutine_script(const entity entity) : entity_script(entity) {}
+};
+
+namespace detail
+{
+void resume_after(u32 slot, f32 seconds);
+void resume_next_frame(u32 slot);
+} // namespace detail
+
+// co_await wait_seconds(2.0f) resumes once that much time has passed in update_all, never in the same frame
+struct wait_seconds
+{
+    constexpr explicit wait_seconds(f32 s) : seconds{ s } {}
+
+    [[nodiscard]] constexpr bool await_ready() const { return false; }
+    void                         await_suspend(task::handle h) const { detail::resume_after(h.promise().slot, seconds); }
+    constexpr void               await_resume() const {}
+
+    f32 seconds;
+};
+
+// co_await next_frame() resumes in the next update_all
+struct next_frame
+{
+    [[nodiscard]] constexpr bool await_ready() const { return false; }
+    void                         await_suspend(task::handle h) const { detail::resume_next_frame(h.promise().slot); }
+    constexpr void               await_resume() const {}
+};
+
 
 namespace detail
 {
-using script_ptr     = scope<entity_script>;
+// Returns a script to the pool of its type. The pool lives in the module that registered the script, so a game module
+// loaded by the editor destroys and frees its own scripts
+struct script_deleter
+{
+    void (*destroy)(entity_script* script){ nullptr };
+
+    void operator()(entity_script* script) const { destroy(script); }
+};
+
+using script_ptr     = std::unique_ptr<entity_script, script_deleter>;
 using script_creator = script_ptr (*)(game_entity::entity entity);
+// Updates count scripts that are all of the same type
+using script_updater = void (*)(const script_ptr* scripts, u32 count, f32 delta);
 
-u8 register_script(size_t tag, script_creator func);
+// updater is nullptr for coroutine scripts, which are resumed instead of updated
+u8 register_script(size_t tag, script_creator func, script_updater updater, update_policy policy);
 
 L_EXPORT script_creator get_script_creator(size_t tag);
 
+// Slabs of scripts of one type, so spawning and removing scripted entities reuses memory instead of allocating
+template<class T>
+using script_pool_type = utl::object_pool<T, 64, utl::tracking_allocator<utl::memory_tag::scripts>>;
+
+template<class T>
+script_pool_type<T>& script_pool()
+{
+    static script_pool_type<T> pool;
+    return pool;
+}
+
+template<class T>
+void destroy_script(entity_script* script)
+{
+    script_pool<T>().destroy(static_cast<T*>(script));
+}
+
 template<class T>
 script_ptr create_script(game_entity::entity entity)
 {
     assert(entity.is_valid());
-    return create_scope<T>(entity);
+    return script_ptr{ script_pool<T>().create(entity), script_deleter{ &destroy_script<T> } };
+}
+
+// The qualified call isn't virtual, so the whole loop is one type's update and can be inlined
+template<class T>
+void update_scripts(const script_ptr* scripts, u32 count, f32 delta)
+{
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        static_cast<T*>(scripts[i].get())->T::update(delta);
+    }
+}
+
+template<class T>
+constexpr script_updater get_updater()
+{
+    if constexpr (std::is_base_of_v<coroutine_script, T>)
+        return nullptr;
+    else
+        return &update_scripts<T>;
+}
+
+template<class T>
+constexpr update_policy get_policy()
+{
+    if constexpr (requires { T::policy; })
+        return T::policy;
+    else
+        return {};
 }
 
 #ifdef L_EDITOR
@@ -102,7 +292,9 @@ u8 add_script_name(const char* name);
         namespace                                                                                                                \
         {                                                                                                                        \
         const u8 reg_##Type =                                                                                                    \
-            lotus::script::detail::register_script(string_hash()(#Type), &lotus::script::detail::create_script<Type>);           \
+            lotus::script::detail::register_script(string_hash()(#Type), &lotus::script::detail::create_script<Type>,            \
+                                                   lotus::script::detail::get_updater<Type>(),                                   \
+                                                   lotus::script::detail::get_policy<Type>());                                   \
         const uint8 name_##Type = lotus::script::detail::add_script_name(#Type);                                                 \
         }
 #else
@@ -111,7 +303,9 @@ u8 add_script_name(const char* name);
         namespace                                                                                                                \
         {                                                                                                                        \
         const u8 reg_##Type =                                                                                                    \
-            lotus::script::detail::register_script(string_hash()(#Type), &lotus::script::detail::create_script<Type>);           \
+            lotus::script::detail::register_script(string_hash()(#Type), &lotus::script::detail::create_script<Type>,            \
+                                                   lotus::script::detail::get_updater<Type>(),                                   \
+                                                   lotus::script::detail::get_policy<Type>());                                   \
         }
 #endif
 } // namespace detail
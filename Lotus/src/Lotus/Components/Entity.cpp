@@ -23,20 +23,70 @@
 #include "Entity.h"
 #include "Transform.h"
 #include "Script.h"
+#include "Util/IOStream.h"
+#include "../Core/JobSystem.h"
 
 
 namespace lotus::game_entity
 {
 namespace
 {
-utl::vector<id::gen_type>         generations;
-utl::deque<entity_id>             free_ids;
-utl::vector<transform::component> transforms;
-utl::vector<script::component>    scripts;
+using entity_allocator = utl::tracking_allocator<utl::memory_tag::entities>;
+
+utl::chunked_vector<id::gen_type, 10, entity_allocator>         generations;
+utl::chunked_vector<transform::component, 10, entity_allocator> transforms; // invalid for removed entities
+utl::chunked_vector<script::component, 10, entity_allocator>    scripts;
+utl::deque<entity_id>                                           free_ids;
+
+// A snapshot starts with a header of its magic, version, size in bytes and the generation, free id, plain entity and
+// scripted entity counts. The generations, free ids, plain entity ids, scripted entity ids, script tags and the
+// transforms follow, each as one block
+constexpr u32 snapshot_magic{ 0x504E'534C }; // "LSNP"
+constexpr u32 snapshot_version{ 1 };
+constexpr u64 snapshot_header_size{ 2 * sizeof(u32) + sizeof(u64) + 4 * sizeof(u32) };
+
+static_assert(sizeof(entity_id) == sizeof(id::id_type));
+
+// Live entities in index order, the ones with a script separate from the others
+void gather_entities(utl::vector<entity_id>& plain_ids, utl::vector<entity_id>& scripted_ids,
+                     utl::vector<script::component>& script_components)
+{
+    for (u32 i{ 0 }; i < transforms.size(); ++i)
+    {
+        if (!transforms[i].is_valid())
+            continue;
+
+        const entity_id id{ transforms[i].get_id() };
+        if (scripts[i].is_valid())
+        {
+            scripted_ids.emplace_back(id);
+            script_components.emplace_back(scripts[i]);
+        } else
+        {
+            plain_ids.emplace_back(id);
+        }
+    }
+}
+
+template<typename T>
+void write_block(utl::blob_stream_writer& writer, const utl::vector<T>& items)
+{
+    if (!items.empty())
+        writer.write((const u8*) items.data(), items.size() * sizeof(T));
+}
+
+template<typename T>
+void read_block(utl::blob_stream_reader& reader, utl::vector<T>& items, u32 count)
+{
+    items.resize(count);
+    if (count)
+        reader.read((u8*) items.data(), count * sizeof(T));
+}
 } // anonymous namespace
 
 entity create(const create_info& info)
 {
+    assert(!jobs::on_worker_thread());
     assert(info.transform);
     if (!info.transform)
         return {};
@@ -53,8 +103,6 @@ entity create(const create_info& info)
     {
         ident = entity_id{ (id::id_type) generations.size() };
         generations.push_back(0);
-
-        // transforms.resize(generations.size()) // --> more memory allocations than emplace_back
         transforms.emplace_back();
         scripts.emplace_back();
     }
@@ -80,6 +128,7 @@ entity create(const create_info& info)
 
 void remove(const entity_id id)
 {
+    assert(!jobs::on_worker_thread());
     const id::id_type index = id::index(id);
     assert(is_alive(id));
 
@@ -94,6 +143,79 @@ void remove(const entity_id id)
     free_ids.push_back(id);
 }
 
+void create_batch(const create_info* const infos, const u32 count, entity* const out)
+{
+    assert(!jobs::on_worker_thread());
+    assert(infos && count && out);
+
+    // Recycle as many ids as create would have, then append the rest after the last index
+    const u32 recycled{ free_ids.size() > id::min_deleted_elements
+                            ? std::min(count, (u32) (free_ids.size() - id::min_deleted_elements))
+                            : 0 };
+    for (u32 i{ 0 }; i < recycled; ++i)
+    {
+        const entity_id ident{ id::new_generation(free_ids.front()) };
+        assert(!is_alive(free_ids.front()));
+        free_ids.pop_front();
+        ++generations[id::index(ident)];
+        out[i] = entity{ ident };
+    }
+
+    const id::id_type first_index{ (id::id_type) generations.size() };
+    generations.resize(generations.size() + count - recycled, 0);
+    transforms.resize(generations.size());
+    scripts.resize(generations.size());
+    for (u32 i{ recycled }; i < count; ++i)
+    {
+        out[i] = entity{ entity_id{ first_index + i - recycled } };
+    }
+
+    utl::vector<transform::component> created(count);
+    transform::create_batch(infos, out, count, created.data());
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        assert(infos[i].transform);
+        transforms[id::index(out[i].get_id())] = created[i];
+    }
+
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        if (!infos[i].script || !infos[i].script->script_creator)
+            continue;
+
+        const id::id_type index{ id::index(out[i].get_id()) };
+        scripts[index] = script::create(*infos[i].script, out[i]);
+        assert(scripts[index].is_valid());
+    }
+}
+
+void remove_batch(const entity* const entities, const u32 count)
+{
+    assert(!jobs::on_worker_thread());
+    assert(entities && count);
+
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        const entity_id   id{ entities[i].get_id() };
+        const id::id_type index{ id::index(id) };
+        assert(is_alive(id));
+
+        if (scripts[index].is_valid())
+        {
+            script::remove(scripts[index]);
+            scripts[index] = {};
+        }
+
+        transform::remove(transforms[index]);
+        transforms[index] = {};
+    }
+
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        free_ids.push_back(entities[i].get_id());
+    }
+}
+
 bool is_alive(const entity_id id)
 {
     assert(id::is_valid(id));
@@ -102,6 +224,159 @@ bool is_alive(const entity_id id)
     return generations[index] == id::generation(id) && transforms[index].is_valid();
 }
 
+bool save_snapshot(scope<u8[]>& data, u64& size)
+{
+    utl::vector<entity_id>         plain_ids;
+    utl::vector<entity_id>         scripted_ids;
+    utl::vector<script::component> script_components;
+    gather_entities(plain_ids, scripted_ids, script_components);
+
+    utl::vector<u64> tags(script_components.size());
+    for (u32 i{ 0 }; i < script_components.size(); ++i)
+    {
+        tags[i] = script::get_tag(script_components[i]);
+        if (!tags[i])
+            return false;
+    }
+
+    size = snapshot_header_size + generations.size() * sizeof(id::gen_type) +
+           (free_ids.size() + plain_ids.size() + scripted_ids.size()) * sizeof(id::id_type) + tags.size() * sizeof(u64) +
+           transform::snapshot_size();
+    data = create_scope<u8[]>(size);
+
+    utl::blob_stream_writer writer{ data.get(), size };
+    writer.write(snapshot_magic);
+    writer.write(snapshot_version);
+    writer.write(size);
+    writer.write((u32) generations.size());
+    writer.write((u32) free_ids.size());
+    writer.write((u32) plain_ids.size());
+    writer.write((u32) scripted_ids.size());
+
+    generations.for_each_page([&writer](const id::gen_type* items, u64 count) {
+        writer.write((const u8*) items, count * sizeof(id::gen_type));
+    });
+    for (const entity_id id : free_ids)
+    {
+        writer.write((id::id_type) id);
+    }
+    write_block(writer, plain_ids);
+    write_block(writer, scripted_ids);
+    write_block(writer, tags);
+    transform::write_snapshot(writer);
+
+    assert(writer.offset() == size);
+    return true;
+}
+
+bool load_snapshot(const u8* const data, const u64 size)
+{
+    assert(!jobs::on_worker_thread());
+    assert(data);
+    if (size < snapshot_header_size)
+        return false;
+
+    utl::blob_stream_reader reader{ data };
+    if (reader.read<u32>() != snapshot_magic || reader.read<u32>() != snapshot_version || reader.read<u64>() != size)
+        return false;
+
+    const u32 generation_count{ reader.read<u32>() };
+    const u32 free_id_count{ reader.read<u32>() };
+    const u32 plain_count{ reader.read<u32>() };
+    const u32 scripted_count{ reader.read<u32>() };
+
+    // Everything is checked before the world is destroyed, so a bad snapshot leaves it as it was
+    const u64 entities_size{ snapshot_header_size + (u64) generation_count * sizeof(id::gen_type) +
+                             ((u64) free_id_count + plain_count + scripted_count) * sizeof(id::id_type) +
+                             (u64) scripted_count * sizeof(u64) };
+    if (size < entities_size + sizeof(u32))
+        return false;
+    // Transform ids are the entity ids, so there is a transform for every index
+    const u32 transform_count{ utl::blob_stream_reader{ data + entities_size }.read<u32>() };
+    if (transform_count != generation_count || size != entities_size + transform::snapshot_size(transform_count))
+        return false;
+
+    utl::vector<id::gen_type> loaded_generations;
+    utl::vector<entity_id>    loaded_free_ids;
+    utl::vector<entity_id>    plain_ids;
+    utl::vector<entity_id>    scripted_ids;
+    utl::vector<u64>          tags;
+    read_block(reader, loaded_generations, generation_count);
+    read_block(reader, loaded_free_ids, free_id_count);
+    read_block(reader, plain_ids, plain_count);
+    read_block(reader, scripted_ids, scripted_count);
+    read_block(reader, tags, scripted_count);
+
+    // No index is listed twice across the free, plain and scripted ids, and each id has the generation saved for its index
+    utl::vector<u8> used(generation_count, 0);
+    const auto      use_ids{ [&](const utl::vector<entity_id>& ids) {
+        for (const entity_id id : ids)
+        {
+            const id::id_type index{ id::index(id) };
+            if (!id::is_valid(id) || index >= generation_count || used[index] ||
+                loaded_generations[index] != id::generation(id))
+                return false;
+            used[index] = 1;
+        }
+        return true;
+    } };
+    if (!use_ids(loaded_free_ids) || !use_ids(plain_ids) || !use_ids(scripted_ids))
+        return false;
+
+    // Scripts of a type that isn't registered (anymore) can't be created again
+    utl::vector<script::detail::script_creator> creators(scripted_count);
+    for (u32 i{ 0 }; i < scripted_count; ++i)
+    {
+        creators[i] = script::find_script_creator(tags[i]);
+        if (!creators[i])
+            return false;
+    }
+
+    // Only the scripts need to be destroyed one by one, the transforms are overwritten and the ids replaced wholesale
+    for (u32 i{ 0 }; i < scripts.size(); ++i)
+    {
+        if (scripts[i].is_valid())
+            script::remove(scripts[i]);
+    }
+
+    generations.clear();
+    for (const id::gen_type generation : loaded_generations)
+    {
+        generations.push_back(generation);
+    }
+
+    free_ids.clear();
+    for (const entity_id id : loaded_free_ids)
+    {
+        free_ids.push_back(id);
+    }
+
+    // Transform ids are the entity ids
+    transform::read_snapshot(reader);
+    transforms.clear();
+    scripts.clear();
+    transforms.resize(generation_count);
+    scripts.resize(generation_count);
+    for (const entity_id id : plain_ids)
+    {
+        transforms[id::index(id)] = transform::component{ transform::transform_id{ id } };
+    }
+    for (u32 i{ 0 }; i < scripted_count; ++i)
+    {
+        const id::id_type index{ id::index(scripted_ids[i]) };
+        transforms[index] = transform::component{ transform::transform_id{ scripted_ids[i] } };
+    }
+
+    for (u32 i{ 0 }; i < scripted_count; ++i)
+    {
+        const script::create_info info{ creators[i] };
+        scripts[id::index(scripted_ids[i])] = script::create(info, entity{ scripted_ids[i] });
+    }
+
+    assert(reader.offset() == size);
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Entity Class Implementations ////////////////////////////////////////////////////////////////////////////////////////
@@ -47,6 +47,16 @@ struct create_info
 
 entity create(const create_info& info);
 void   remove(entity_id id);
+// Bulk versions of create and remove. Every info must have a transform
+void create_batch(const create_info* infos, u32 count, entity* out);
+void remove_batch(const entity* entities, u32 count);
 bool   is_alive(entity_id id);
+
+// Versioned binary image of every entity with its transform and the type of its script, ids included. Script members
+// aren't part of it, scripts are created again when it's loaded. Fails if a script's type was registered by another module
+bool save_snapshot(scope<u8[]>& data, u64& size);
+// Replaces every entity with the ones in a snapshot. Fails, leaving the world as it was, if data isn't a whole and
+// consistent snapshot of this version or has a script type that isn't registered
+bool load_snapshot(const u8* data, u64 size);
 } // namespace game_entity
 } // namespace lotus
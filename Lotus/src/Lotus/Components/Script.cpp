@@ -23,8 +23,9 @@
 #include "Script.h"
 #include "Entity.h"
 #include "Transform.h"
+#include "../Core/JobSystem.h"
 
-#define USE_TRANSFORM_CACHE_MAP 0
+#define USE_PARALLEL_SCRIPT_UPDATE 1
 
 namespace lotus::script
 {
@@ -34,15 +35,350 @@ namespace
 {
 using script_registry = std::unordered_map<size_t, detail::script_creator>;
 
-utl::vector<detail::script_ptr> entity_scripts;
-utl::vector<id::id_type>        id_mapping;
-utl::vector<id::gen_type>       generations;
-utl::deque<script_id>           free_ids;
+struct script_type
+{
+    size_t                 tag;
+    detail::script_updater updater;
+    update_policy          policy;
+};
+using type_registry = std::unordered_map<detail::script_creator, script_type>;
+
+using script_allocator = utl::tracking_allocator<utl::memory_tag::scripts>;
+
+// Scripts of one type that are updated every interval frames, on the frames whose number modulo interval is phase
+struct script_bucket
+{
+    u32                                                     interval{ 1 };
+    u32                                                     phase{ 0 };
+    u32                                                     incoming{ 0 }; // scripts in bucket 0 headed here
+    utl::vector<detail::script_ptr, true, script_allocator> scripts;
+};
+
+// Scripts are kept together with the other scripts of their type, so each type is updated by one non virtual loop.
+// Groups are created in the order their first script is. Bucket 0 is updated every frame, the others exist if the type's
+// policy skips frames. A script only joins a bucket right after an update a full interval before the bucket's next one,
+// until then it waits in bucket 0, so the time passed to update always covers exactly the frames since the last one
+struct script_group
+{
+    detail::script_creator     creator;
+    detail::script_updater     updater;   // nullptr if the type was registered elsewhere
+    update_policy              policy;
+    bool                       coroutine; // resumed by the scheduler, never updated
+    utl::vector<script_bucket> buckets;
+    utl::vector<u32>           targets; // bucket each script in bucket 0 is headed for, 0 if it stays
+};
+
+struct script_location
+{
+    u32 group{ invalid_id_u32 };
+    u32 bucket{ invalid_id_u32 };
+    u32 index{ invalid_id_u32 };
+};
+
+// Buckets of one group that are due this frame, laid out back to back
+struct script_run
+{
+    u32 group;
+    u32 bucket;
+    f32 delta;
+};
+
+utl::vector<script_group>                            script_groups;
+std::unordered_map<detail::script_creator, u32>      group_indices; // creator to index in script_groups
+utl::vector<script_location, true, script_allocator> id_mapping;
+utl::vector<id::gen_type, true, script_allocator>    generations;
+utl::deque<script_id>                                free_ids;
+
+u64                     frame_number{ 0 };
+f32                     frame_deltas[max_update_interval]{}; // by frame_number modulo max_update_interval
+utl::vector<script_run> due_runs;
+utl::vector<u32>        run_offsets; // first script of each run, and the number of due scripts at the end
+game_entity::entity     active_camera{};
+
+// Running coroutines have a slot. Waits refer to it by index and generation, so destroying a coroutine that is waiting
+// just leaves stale entries behind that are skipped when they come up
+struct coroutine_slot
+{
+    task::handle handle{};
+    u32          script_index{ invalid_id_u32 };
+    u32          generation{ 0 };
+};
+
+struct coroutine_ref
+{
+    u32 slot;
+    u32 generation;
+};
+
+// Waits are kept in the bucket of the tick they are due in, and a bucket is only looked at when its tick comes up, so
+// a waiting coroutine isn't touched until then. Waits further out than one turn of the wheel sit in a heap and are
+// moved into their bucket once the wheel reaches them
+class timer_wheel
+{
+public:
+    constexpr static f64 tick_length{ 0.01 };
+    constexpr static u32 bucket_count{ 512 };
+
+    void add(coroutine_ref ref, f32 seconds)
+    {
+        u64 due{ (u64) std::ceil((m_time + seconds) / tick_length) };
+        if (due <= m_tick)
+        {
+            due = m_tick + 1;
+        }
+
+        if (due - m_tick <= bucket_count)
+        {
+            m_buckets[due & mask].emplace_back(ref);
+        } else
+        {
+            m_far.emplace_back(far_wait{ due, ref });
+            std::push_heap(m_far.begin(), m_far.end(), later);
+        }
+    }
+
+    // Appends every wait that came due to ready
+    void advance(f32 delta, utl::vector<coroutine_ref>& ready)
+    {
+        m_time += delta;
+        const u64 target{ (u64) (m_time / tick_length) };
+        while (m_tick < target)
+        {
+            ++m_tick;
+            utl::vector<coroutine_ref>& bucket{ m_buckets[m_tick & mask] };
+            for (u32 i{ 0 }; i < bucket.size(); ++i)
+            {
+                ready.emplace_back(bucket[i]);
+            }
+            bucket.clear();
+
+            // After the bucket, one due a whole turn from now goes into the bucket that was just emptied
+            while (!m_far.empty() && m_far.front().due - m_tick <= bucket_count)
+            {
+                m_buckets[m_far.front().due & mask].emplace_back(m_far.front().ref);
+                std::pop_heap(m_far.begin(), m_far.end(), later);
+                m_far.resize(m_far.size() - 1);
+            }
+        }
+    }
+
+    void clear()
+    {
+        for (u32 i{ 0 }; i < bucket_count; ++i)
+        {
+            m_buckets[i].clear();
+        }
+        m_far.clear();
+        m_time = 0.0;
+        m_tick = 0;
+    }
+
+private:
+    constexpr static u64 mask{ bucket_count - 1 };
+    static_assert((bucket_count & (bucket_count - 1)) == 0);
+
+    struct far_wait
+    {
+        u64           due;
+        coroutine_ref ref;
+    };
+
+    static bool later(const far_wait& a, const far_wait& b) { return a.due > b.due; }
+
+    utl::vector<coroutine_ref> m_buckets[bucket_count];
+    utl::vector<far_wait>      m_far; // min heap on due
+    f64                        m_time{ 0.0 };
+    u64                        m_tick{ 0 };
+};
+
+utl::vector<coroutine_slot> coroutines;
+utl::vector<u32>            free_coroutines;
+utl::vector<u32>            script_coroutines; // coroutine slot by script id index, invalid_id_u32 if there is none
+utl::vector<coroutine_ref>  next_frame_queue;
+utl::vector<coroutine_ref>  resume_queue;
+timer_wheel                 timers;
+u32                         running_coroutine{ invalid_id_u32 };
+// A coroutine that removes its own script is still running. Its frame and script are freed once it suspends
+bool                        running_stopped{ false };
+detail::script_ptr          running_script{};
+
+// Finds the cache entry of a transform in O(1). Slots are addressed by entity index and only count as used if they were
+// written in the current epoch, so starting over with an empty cache is just bumping the epoch instead of clearing
+class cache_slot_table
+{
+public:
+    [[nodiscard]] transform::component_cache* get(utl::vector<transform::component_cache>& caches, transform::transform_id id)
+    {
+        const id::id_type index{ id::index(id) };
+        if (index >= m_slots.size())
+        {
+            m_slots.resize(std::max((u64) index + 1, m_slots.size() * 2));
+        }
+
+        slot& s{ m_slots[index] };
+        if (s.epoch != m_epoch || caches[s.cache_index].id != id)
+        {
+            s.epoch       = m_epoch;
+            s.cache_index = (u32) caches.size();
+            caches.emplace_back();
+            caches.back().id = id;
+        }
+
+        assert(s.cache_index < caches.size());
+        return &caches[s.cache_index];
+    }
+
+    void next_epoch()
+    {
+        if (++m_epoch == 0)
+        {
+            // Wrapped around, slots from 2^32 epochs ago would look current
+            memset(m_slots.data(), 0, m_slots.size() * sizeof(slot));
+            m_epoch = 1;
+        }
+    }
+
+private:
+    struct slot
+    {
+        u32 epoch{ 0 };
+        u32 cache_index{ 0 };
+    };
+
+    utl::vector<slot> m_slots;
+    u32               m_epoch{ 1 };
+};
+
+struct transform_write_target
+{
+    utl::vector<transform::component_cache>* caches;
+    cache_slot_table*                        slots;
+};
 
 utl::vector<transform::component_cache> transform_cache;
+cache_slot_table                        transform_cache_slots;
+
+// Transform writes made by scripts go to whichever cache the current thread is updating into
+thread_local transform_write_target current_target{ &transform_cache, &transform_cache_slots };
+
+// A multiple of 8 so every range starts where update_matrices can skip 8 clean transforms at a time
+constexpr u32 transforms_per_job{ 4096 };
+
+void update_run(const script_run& run, u32 first, u32 count)
+{
+    if (!count)
+        return;
+
+    const script_group&             group{ script_groups[run.group] };
+    const detail::script_ptr* const scripts{ &group.buckets[run.bucket].scripts[first] };
+    const f32                       delta{ run.delta };
+    if (group.updater)
+    {
+        group.updater(scripts, count, delta);
+    } else
+    {
+        for (u32 i{ 0 }; i < count; ++i)
+        {
+            scripts[i]->update(delta);
+        }
+    }
+}
+
+#if USE_PARALLEL_SCRIPT_UPDATE
+// Fewer scripts than this per chunk aren't worth the cost of waking the workers and merging the caches
+constexpr u32 min_scripts_per_chunk{ 256 };
+// More chunks than threads so a thread that finishes early can pick up more work
+constexpr u32 chunks_per_thread{ 4 };
+
+// Each chunk is a contiguous range of the due scripts being updated in parallel, in run order, with its own transform
+// cache. The slot tables are per thread rather than per chunk, a thread just starts a new epoch when it moves on to
+// another chunk
+utl::vector<utl::vector<transform::component_cache>> chunk_caches;
+thread_local cache_slot_table                        chunk_cache_slots;
+u32                                                  scripts_per_chunk{ 0 };
+u32                                                  parallel_first{ 0 }; // due scripts updated in parallel
+u32                                                  parallel_last{ 0 };
+
+void update_chunk(u32 chunk_index)
+{
+    u32       first{ parallel_first + chunk_index * scripts_per_chunk };
+    const u32 last{ std::min(first + scripts_per_chunk, parallel_last) };
+
+    const transform_write_target previous_target{ current_target };
+    chunk_cache_slots.next_epoch();
+    current_target = { &chunk_caches[chunk_index], &chunk_cache_slots };
+
+    // A chunk can span the end of one run and the start of the next
+    u32 run{ (u32) (std::upper_bound(run_offsets.begin(), run_offsets.end(), first) - run_offsets.begin()) - 1 };
+    while (first < last)
+    {
+        const u32 count{ std::min(last, run_offsets[run + 1]) - first };
+        update_run(due_runs[run], first - run_offsets[run], count);
+        first += count;
+        ++run;
+    }
+
+    current_target = previous_target;
+}
+
+void merge_cache(transform::component_cache& dst, const transform::component_cache& src)
+{
+    assert(dst.id == src.id);
+    if (src.flags & transform::component_flags::rotation)
+    {
+        dst.rotation = src.rotation;
+    }
+    if (src.flags & transform::component_flags::orientation)
+    {
+        dst.orientation = src.orientation;
+    }
+    if (src.flags & transform::component_flags::position)
+    {
+        dst.position = src.position;
+    }
+    if (src.flags & transform::component_flags::scale)
+    {
+        dst.scale = src.scale;
+    }
+    dst.flags |= src.flags;
+}
+
+// Chunks are merged in script order, so when two scripts write the same transform the later one wins exactly as it would
+// in a serial update
+void merge_chunk_caches(u32 chunk_count)
+{
+    for (u32 chunk{ 0 }; chunk < chunk_count; ++chunk)
+    {
+        const utl::vector<transform::component_cache>& caches{ chunk_caches[chunk] };
+        for (u32 i{ 0 }; i < caches.size(); ++i)
+        {
+            merge_cache(*transform_cache_slots.get(transform_cache, caches[i].id), caches[i]);
+        }
 
-#if USE_TRANSFORM_CACHE_MAP
-std::unordered_map<id::id_type, u32> cache_map;
+        chunk_caches[chunk].clear();
+    }
+}
+
+// Due scripts from first to last, which all belong to types that update in parallel
+void update_scripts_parallel(u32 first, u32 last, u32 chunk_count)
+{
+    if (chunk_caches.size() < chunk_count)
+    {
+        chunk_caches.resize(chunk_count);
+    }
+
+    parallel_first    = first;
+    parallel_last     = last;
+    scripts_per_chunk = (last - first + chunk_count - 1) / chunk_count;
+
+    jobs::parallel_for(chunk_count, 1, [](u32 first, u32 last) {
+        for (u32 chunk{ first }; chunk < last; ++chunk)
+        {
+            update_chunk(chunk);
+        }
+    });
+    merge_chunk_caches(chunk_count);
+}
 #endif
 
 script_registry& registry()
@@ -51,77 +387,400 @@ script_registry& registry()
     return reg;
 }
 
+type_registry& types()
+{
+    static type_registry reg;
+    return reg;
+}
 
-bool exists(const script_id id)
+u32 get_group(detail::script_creator creator)
 {
-    assert(id::is_valid(id));
-    const id::id_type index = id::index(id);
-    assert((index < generations.size() && id_mapping[index] < entity_scripts.size()) && generations[index] == id::generation(id));
-    return (generations[index] == id::generation(id)) && entity_scripts[id_mapping[index]] &&
-           entity_scripts[id_mapping[index]]->is_valid();
+    if (const auto it{ group_indices.find(creator) }; it != group_indices.end())
+        return it->second;
+
+    // Creators from a game module loaded by the editor aren't in this module's registry, those are updated virtually
+    // every frame
+    const auto type{ types().find(creator) };
+    const bool registered{ type != types().end() };
+
+    script_group group{ creator, nullptr, {}, false, {}, {} };
+    if (registered)
+    {
+        group.updater   = type->second.updater;
+        group.policy    = type->second.policy;
+        group.coroutine = !group.updater;
+    }
+
+    update_policy& policy{ group.policy };
+    policy.interval = std::clamp(policy.interval, 1u, max_update_interval);
+    if (group.coroutine)
+    {
+        policy = {};
+    } else if (policy.kind == update_policy::distance)
+    {
+        policy.interval = std::bit_floor(policy.interval);
+        assert(policy.far_distance >= policy.near_distance);
+    }
+
+    // Bucket 0, then every_n_frames has one bucket per phase and distance one per phase of each power of two interval
+    const auto add_buckets{ [&group](u32 interval) {
+        for (u32 phase{ 0 }; phase < interval; ++phase)
+        {
+            group.buckets.emplace_back(script_bucket{ interval, phase, 0, {} });
+        }
+    } };
+
+    group.buckets.emplace_back();
+    if (policy.kind == update_policy::every_n_frames && policy.interval > 1)
+    {
+        add_buckets(policy.interval);
+    } else if (policy.kind == update_policy::distance)
+    {
+        for (u32 interval{ 2 }; interval <= policy.interval; interval *= 2)
+        {
+            add_buckets(interval);
+        }
+    }
+
+    const u32 index{ (u32) script_groups.size() };
+    script_groups.emplace_back(std::move(group));
+    group_indices[creator] = index;
+    return index;
 }
 
-#ifdef L_EDITOR
-utl::vector<std::string>& script_names()
+u32 first_bucket(const script_group& group, u32 interval)
 {
-    static utl::vector<std::string> names;
-    return names;
+    if (interval == 1)
+        return 0;
+
+    return group.policy.kind == update_policy::distance ? interval - 1 : 1;
 }
-#endif
 
-#if USE_TRANSFORM_CACHE_MAP
-transform::component_cache* const get_cache_ptr(const game_entity::entity* const entity)
+// The phase of the interval with the fewest scripts, so scripts created together are spread over the frames
+u32 least_loaded_bucket(const script_group& group, u32 interval)
 {
-    assert(game_entity::is_alive(entity->get_id()));
-    const transform::transform_id id{ entity->transform().get_id() };
+    const u32 first{ first_bucket(group, interval) };
+    u32       best{ first };
+    for (u32 i{ first + 1 }; i < first + interval; ++i)
+    {
+        const script_bucket& bucket{ group.buckets[i] };
+        if (bucket.scripts.size() + bucket.incoming < group.buckets[best].scripts.size() + group.buckets[best].incoming)
+        {
+            best = i;
+        }
+    }
+    return best;
+}
 
-    u32 index{ invalid_id_u32 };
-    const auto [fst, snd]{ cache_map.try_emplace(id, id::invalid_id) };
+void add_to_bucket(u32 group_index, u32 bucket_index, detail::script_ptr&& script, id::id_type id_index, u32 target)
+{
+    script_group&  group{ script_groups[group_index] };
+    script_bucket& bucket{ group.buckets[bucket_index] };
+    id_mapping[id_index] = { group_index, bucket_index, (u32) bucket.scripts.size() };
+    bucket.scripts.emplace_back(std::move(script));
+
+    if (!bucket_index)
+    {
+        group.targets.emplace_back(target);
+        if (target)
+        {
+            ++group.buckets[target].incoming;
+        }
+    }
+}
+
+// Leaves the script moved from or destroyed. The last script of the bucket takes its place
+void remove_from_bucket(const script_location location)
+{
+    script_group&  group{ script_groups[location.group] };
+    script_bucket& bucket{ group.buckets[location.bucket] };
+    const u32      last{ (u32) bucket.scripts.size() - 1 };
+    if (location.index != last)
+    {
+        id_mapping[id::index(bucket.scripts[last]->script().get_id())] = location;
+    }
+    utl::erase_unordered(bucket.scripts, location.index);
+
+    if (!location.bucket)
+    {
+        if (group.targets[location.index])
+        {
+            --group.buckets[group.targets[location.index]].incoming;
+        }
+        utl::erase_unordered(group.targets, location.index);
+    }
+}
 
-    if (snd)
+void move_script(const script_location location, u32 bucket_index, u32 target)
+{
+    detail::script_ptr script{ std::move(script_groups[location.group].buckets[location.bucket].scripts[location.index]) };
+    const id::id_type  id_index{ id::index(script->script().get_id()) };
+    remove_from_bucket(location);
+    add_to_bucket(location.group, bucket_index, std::move(script), id_index, target);
+}
+
+// Sum of the deltas of the last interval frames
+f32 accumulated_delta(u32 interval)
+{
+    f32       delta{ 0.0f };
+    const u64 count{ std::min((u64) interval, frame_number) };
+    for (u64 i{ 0 }; i < count; ++i)
     {
-        index = (u32) transform_cache.size();
-        transform_cache.emplace_back();
-        transform_cache.back().id = id;
-        cache_map[id]             = index;
+        delta += frame_deltas[(frame_number - i) % max_update_interval];
+    }
+    return delta;
+}
+
+[[nodiscard]] bool is_due(const script_bucket& bucket)
+{
+    return frame_number % bucket.interval == bucket.phase;
+}
+
+void find_due_runs()
+{
+    due_runs.clear();
+    run_offsets.clear();
+    run_offsets.emplace_back(0);
+
+    for (u32 g{ 0 }; g < script_groups.size(); ++g)
+    {
+        const script_group& group{ script_groups[g] };
+        if (group.coroutine)
+            continue;
+
+        for (u32 b{ 0 }; b < group.buckets.size(); ++b)
+        {
+            const script_bucket& bucket{ group.buckets[b] };
+            if (!bucket.scripts.empty() && is_due(bucket))
+            {
+                due_runs.emplace_back(script_run{ g, b, accumulated_delta(bucket.interval) });
+                run_offsets.emplace_back(run_offsets.back() + (u32) bucket.scripts.size());
+            }
+        }
+    }
+}
+
+u32 distance_interval(const update_policy& policy, const vec3& camera, const vec3& position)
+{
+    const f32 x{ position.x - camera.x };
+    const f32 y{ position.y - camera.y };
+    const f32 z{ position.z - camera.z };
+    const f32 distance{ std::sqrt(x * x + y * y + z * z) };
+    if (distance <= policy.near_distance)
+        return 1;
+    if (distance >= policy.far_distance)
+        return policy.interval;
+
+    // Evenly spaced steps from 2 up to interval
+    const u32 steps{ (u32) std::countr_zero(policy.interval) };
+    const f32 t{ (distance - policy.near_distance) / (policy.far_distance - policy.near_distance) };
+    return 1u << std::min((u32) (t * (f32) steps) + 1, steps);
+}
+
+// Runs after the updates of the frame. Distance scripts that were updated pick the interval for their distance and
+// scripts in bucket 0 join the bucket they are headed for if its next update is a full interval away
+void settle_buckets()
+{
+    const bool has_camera{ active_camera.is_valid() };
+    const vec3 camera{ has_camera ? active_camera.position() : vec3{} };
+
+    for (u32 g{ 0 }; g < script_groups.size(); ++g)
+    {
+        script_group& group{ script_groups[g] };
+        if (group.coroutine || group.buckets.size() == 1)
+            continue;
+
+        if (group.policy.kind == update_policy::distance)
+        {
+            for (u32 b{ 0 }; b < group.buckets.size(); ++b)
+            {
+                script_bucket& bucket{ group.buckets[b] };
+                if (!is_due(bucket))
+                    continue;
+
+                // Backwards, a script that is moved out is replaced by one that was already looked at
+                for (u32 i{ (u32) bucket.scripts.size() }; i > 0; --i)
+                {
+                    const u32 index{ i - 1 };
+                    if (!b && group.targets[index])
+                        continue;
+
+                    const u32 interval{ has_camera ? distance_interval(group.policy, camera, bucket.scripts[index]->position())
+                                                   : 1 };
+                    if (interval == bucket.interval)
+                        continue;
+
+                    const u32 target{ interval == 1 ? 0 : least_loaded_bucket(group, interval) };
+                    if (b)
+                    {
+                        move_script({ g, b, index }, 0, target);
+                    } else if (target)
+                    {
+                        group.targets[index] = target;
+                        ++group.buckets[target].incoming;
+                    }
+                }
+            }
+        }
+
+        script_bucket& waiting{ group.buckets[0] };
+        for (u32 i{ (u32) waiting.scripts.size() }; i > 0; --i)
+        {
+            const u32 target{ group.targets[i - 1] };
+            if (!target)
+                continue;
+
+            // Due this frame means next due a full interval from now
+            if (is_due(group.buckets[target]))
+            {
+                move_script({ g, 0, i - 1 }, target, 0);
+            }
+        }
+    }
+}
+
+// The coroutine is resumed for the first time in the next update_all
+void start_coroutine(id::id_type script_index, task t)
+{
+    u32 slot;
+    if (!free_coroutines.empty())
+    {
+        slot = free_coroutines.back();
+        free_coroutines.resize(free_coroutines.size() - 1);
     } else
     {
-        index = cache_map[id];
+        slot = (u32) coroutines.size();
+        coroutines.emplace_back();
     }
 
-    assert(index < transform_cache.size());
+    coroutine_slot& c{ coroutines[slot] };
+    c.handle = t.release();
+    assert(c.handle);
+    c.handle.promise().slot = slot;
+    c.script_index          = script_index;
 
-    return &transform_cache[index];
+    if (script_index >= script_coroutines.size())
+    {
+        script_coroutines.resize(std::max((u64) script_index + 1, script_coroutines.size() * 2), invalid_id_u32);
+    }
+    script_coroutines[script_index] = slot;
+    next_frame_queue.emplace_back(coroutine_ref{ slot, c.generation });
 }
-#else
-transform::component_cache* const get_cache_ptr(const game_entity::entity* const entity)
+
+void release_coroutine(u32 slot)
 {
-    assert(game_entity::is_alive(entity->get_id()));
-    const transform::transform_id id{ entity->transform().get_id() };
+    coroutine_slot& c{ coroutines[slot] };
+    c.handle.destroy();
+    c.handle = {};
+    ++c.generation;
+    free_coroutines.emplace_back(slot);
+}
 
-    for (auto& cache : transform_cache)
+void stop_coroutine(u32 slot)
+{
+    assert(slot < coroutines.size() && coroutines[slot].handle);
+    coroutine_slot& c{ coroutines[slot] };
+    script_coroutines[c.script_index] = invalid_id_u32;
+
+    // Destroying the frame that is running would pull it out from under itself
+    if (slot == running_coroutine)
     {
-        if (cache.id == id)
+        running_stopped = true;
+        return;
+    }
+
+    release_coroutine(slot);
+}
+
+void resume_coroutines(f32 delta)
+{
+    resume_queue.clear();
+    timers.advance(delta, resume_queue);
+    for (u32 i{ 0 }; i < next_frame_queue.size(); ++i)
+    {
+        resume_queue.emplace_back(next_frame_queue[i]);
+    }
+    next_frame_queue.clear();
+
+    // Coroutines can start new waits and remove scripts while this runs, so slots are looked up every time
+    for (u32 i{ 0 }; i < resume_queue.size(); ++i)
+    {
+        const coroutine_ref ref{ resume_queue[i] };
+        if (coroutines[ref.slot].generation != ref.generation)
+            continue;
+
+        // A copy, starting coroutines can grow the slot vector
+        const task::handle handle{ coroutines[ref.slot].handle };
+        running_coroutine = ref.slot;
+        handle.resume();
+        running_coroutine = invalid_id_u32;
+
+        if (running_stopped)
+        {
+            // The frame first, it can still refer to the script
+            release_coroutine(ref.slot);
+            running_script.reset();
+            running_stopped = false;
+        } else if (handle.done())
         {
-            return &cache;
+            stop_coroutine(ref.slot);
         }
     }
+}
 
-    transform_cache.emplace_back();
-    transform_cache.back().id = id;
 
-    return &transform_cache.back();
+bool exists(const script_id id)
+{
+    assert(id::is_valid(id));
+    const id::id_type index = id::index(id);
+    assert(index < generations.size() && generations[index] == id::generation(id));
+    const script_location& location{ id_mapping[index] };
+    if (location.group == invalid_id_u32)
+        return false;
+
+    assert(location.group < script_groups.size() && location.bucket < script_groups[location.group].buckets.size());
+    const script_bucket& bucket{ script_groups[location.group].buckets[location.bucket] };
+    assert(location.index < bucket.scripts.size());
+    const detail::script_ptr& script{ bucket.scripts[location.index] };
+    return (generations[index] == id::generation(id)) && script && script->is_valid();
+}
+
+#ifdef L_EDITOR
+utl::vector<std::string>& script_names()
+{
+    static utl::vector<std::string> names;
+    return names;
 }
 #endif
 
+transform::component_cache* const get_cache_ptr(const game_entity::entity* const entity)
+{
+    assert(game_entity::is_alive(entity->get_id()));
+    const transform::transform_id id{ entity->transform().get_id() };
+    return current_target.slots->get(*current_target.caches, id);
+}
+
 } // anonymous namespace
 
 namespace detail
 {
-u8 register_script(size_t tag, script_creator func)
+void resume_after(u32 slot, f32 seconds)
+{
+    assert(slot < coroutines.size() && seconds >= 0.0f);
+    timers.add({ slot, coroutines[slot].generation }, seconds);
+}
+
+void resume_next_frame(u32 slot)
+{
+    assert(slot < coroutines.size());
+    next_frame_queue.emplace_back(coroutine_ref{ slot, coroutines[slot].generation });
+}
+
+u8 register_script(size_t tag, script_creator func, script_updater updater, update_policy policy)
 {
     const bool res = registry().insert(script_registry::value_type{ tag, func }).second;
     assert(res);
+    types()[func] = { tag, updater, policy };
     return res;
 }
 
@@ -146,6 +805,7 @@ u8 add_script_name(const char* name)
 
 component create(const create_info& info, const game_entity::entity entity)
 {
+    assert(!jobs::on_worker_thread());
     assert(entity.is_valid() && info.script_creator);
     script_id id;
 
@@ -164,40 +824,154 @@ component create(const create_info& info, const game_entity::entity entity)
     }
 
     assert(id::is_valid(id));
-    const auto index = (id::id_type) entity_scripts.size();
-    entity_scripts.emplace_back(info.script_creator(entity));
-    assert(entity_scripts.back()->get_id() == entity.get_id());
+    const u32           group_index{ get_group(info.script_creator) };
+    const script_group& group{ script_groups[group_index] };
+
+    // Scripts start out updated every frame, so their first update doesn't get the time of frames before they existed
+    const u32 target{ group.policy.kind == update_policy::every_n_frames && group.buckets.size() > 1
+                          ? least_loaded_bucket(group, group.policy.interval)
+                          : 0 };
+    add_to_bucket(group_index, 0, info.script_creator(entity), id::index(id), target);
+
+    const detail::script_ptr& script{ group.buckets[0].scripts.back() };
+    assert(script->get_id() == entity.get_id());
+    if (group.coroutine)
+    {
+        start_coroutine(id::index(id), static_cast<coroutine_script*>(script.get())->run());
+    }
 
-    id_mapping[id::index(id)] = index;
     return component(id);
 }
 
 void remove(const component comp)
+{
+    assert(!jobs::on_worker_thread());
+    assert(comp.is_valid() && exists(comp.get_id()));
+    const script_id       id       = comp.get_id();
+    const script_location location = id_mapping[id::index(id)];
+
+    // Before the script, the coroutine can still refer to it
+    if (script_groups[location.group].coroutine && script_coroutines[id::index(id)] != invalid_id_u32)
+    {
+        const u32 slot{ script_coroutines[id::index(id)] };
+        stop_coroutine(slot);
+        if (slot == running_coroutine)
+        {
+            // The coroutine removed its own script, which has to outlive the frame
+            running_script = std::move(script_groups[location.group].buckets[location.bucket].scripts[location.index]);
+        }
+    }
+
+    remove_from_bucket(location);
+    id_mapping[id::index(id)] = {};
+    free_ids.push_back(id);
+}
+
+size_t get_tag(const component comp)
 {
     assert(comp.is_valid() && exists(comp.get_id()));
-    const script_id   id      = comp.get_id();
-    const id::id_type index   = id_mapping[id::index(id)];
-    const script_id   last_id = entity_scripts.back()->script().get_id();
-    utl::erase_unordered(entity_scripts, index);
-    id_mapping[id::index(last_id)] = index;
-    id_mapping[id::index(id)]      = id::invalid_id;
+    const script_location location{ id_mapping[id::index(comp.get_id())] };
+    const auto            type{ types().find(script_groups[location.group].creator) };
+    return type != types().end() ? type->second.tag : 0;
+}
+
+detail::script_creator find_script_creator(const size_t tag)
+{
+    const auto script{ registry().find(tag) };
+    return script != registry().end() ? script->second : nullptr;
 }
 
 void update_all(f32 delta)
 {
-    for (const auto& scr : entity_scripts)
+    ++frame_number;
+    frame_deltas[frame_number % max_update_interval] = delta;
+    find_due_runs();
+
+    for (u32 run{ 0 }; run < due_runs.size();)
     {
-        scr->update(delta);
+#if USE_PARALLEL_SCRIPT_UPDATE
+        // Back to back runs of types that opted in are updated together, and merged before the next run on this thread,
+        // so the transform writes land in the same order as in a serial update
+        u32 end{ run };
+        while (end < due_runs.size() && script_groups[due_runs[end].group].policy.parallel)
+        {
+            ++end;
+        }
+
+        const u32 due_count{ run_offsets[end] - run_offsets[run] };
+        if (jobs::thread_count() > 1 && due_count >= 2 * min_scripts_per_chunk)
+        {
+            const u32 chunk_count{ std::min(due_count / min_scripts_per_chunk, jobs::thread_count() * chunks_per_thread) };
+            update_scripts_parallel(run_offsets[run], run_offsets[end], chunk_count);
+            run = end;
+            continue;
+        }
+#endif
+        update_run(due_runs[run], 0, run_offsets[run + 1] - run_offsets[run]);
+        ++run;
     }
 
+    // On this thread, after the other scripts, so their writes land in the same cache in the same order every frame
+    resume_coroutines(delta);
+
     if (!transform_cache.empty())
     {
         transform::update(transform_cache.data(), (u32) transform_cache.size());
         transform_cache.clear();
-#if USE_TRANSFORM_CACHE_MAP
-        cache_map.clear();
-#endif
+        transform_cache_slots.next_epoch();
+    }
+
+    // After the transform writes so distances are measured from where things are now
+    settle_buckets();
+
+    // Done here so rendering only has to read the matrices and the changes of this frame
+    transform::prepare_hierarchy();
+    jobs::parallel_for(transform::transform_count(), transforms_per_job,
+                       [](u32 first, u32 last) { transform::update_matrices(first, last); });
+    transform::propagate_hierarchy();
+    transform::publish_changes();
+}
+
+void set_active_camera(game_entity::entity camera)
+{
+    active_camera = camera;
+}
+
+void shutdown()
+{
+    for (u32 i{ 0 }; i < coroutines.size(); ++i)
+    {
+        if (coroutines[i].handle)
+        {
+            stop_coroutine(i);
+        }
     }
+    coroutines.clear();
+    free_coroutines.clear();
+    script_coroutines.clear();
+    next_frame_queue.clear();
+    resume_queue.clear();
+    timers.clear();
+
+    // Scripts that are still alive have to go before the pools they were created in are destroyed at exit
+    script_groups.clear();
+    group_indices.clear();
+    id_mapping.clear();
+    generations.clear();
+    free_ids.clear();
+    active_camera = {};
+
+    // Bucket phases and the delta passed to scripts that skip frames start over with the frame count
+    frame_number = 0;
+    std::fill(std::begin(frame_deltas), std::end(frame_deltas), 0.0f);
+    due_runs.clear();
+    run_offsets.clear();
+    transform_cache.clear();
+    transform_cache_slots.next_epoch();
+
+#if USE_PARALLEL_SCRIPT_UPDATE
+    chunk_caches.clear();
+#endif
 }
 
 // From API/GameEntity.h
@@ -35,4 +35,16 @@ component create(const create_info& info, game_entity::entity entity);
 void      remove(component comp);
 void      update_all(f32 delta);
 
+// Tag the type of the script was registered with, 0 if it was registered by another module
+[[nodiscard]] size_t get_tag(component comp);
+// The creator registered with tag, nullptr if there is none
+[[nodiscard]] detail::script_creator find_script_creator(size_t tag);
+
+// Scripts with a distance update policy measure from this entity. Without one they are updated every frame. Must be set
+// to an invalid entity before the camera entity is removed
+void set_active_camera(game_entity::entity camera);
+
+// Destroys the scripts that are still alive and resets the scheduler, so the script system starts over as if new
+void shutdown();
+
 } // namespace lotus::script
@@ -21,21 +21,108 @@
 //
 // ------------------------------------------------------------------------------
 #include "Transform.h"
+#include "Entity.h"
+#include "Util/IOStream.h"
+#include "../Core/JobSystem.h"
+
+#include <immintrin.h>
 
 namespace lotus::transform
 {
 
 namespace
 {
-utl::vector<mat4> to_world;
-utl::vector<mat4> inv_world;
-utl::vector<vec4> rotations;
-utl::vector<vec3> orientations;
-utl::vector<vec3> positions;
-utl::vector<vec3> scales;
-utl::vector<u8>   has_transform;
-utl::vector<u8>   changes_from_previous_frame;
-u8                read_write_flag;
+
+// Matrices are computed in batches of simd_width transforms. The batch is gathered into SoA lanes so every lane of a
+// register holds the same component of a different transform
+#if defined(__AVX2__)
+constexpr u32 simd_width{ 8 };
+using simd_f32 = __m256;
+
+inline simd_f32 simd_load(const f32* p) { return _mm256_load_ps(p); }
+inline void     simd_store(f32* p, simd_f32 v) { _mm256_store_ps(p, v); }
+inline simd_f32 simd_set(f32 v) { return _mm256_set1_ps(v); }
+inline simd_f32 simd_add(simd_f32 a, simd_f32 b) { return _mm256_add_ps(a, b); }
+inline simd_f32 simd_sub(simd_f32 a, simd_f32 b) { return _mm256_sub_ps(a, b); }
+inline simd_f32 simd_mul(simd_f32 a, simd_f32 b) { return _mm256_mul_ps(a, b); }
+inline simd_f32 simd_div(simd_f32 a, simd_f32 b) { return _mm256_div_ps(a, b); }
+#else
+constexpr u32 simd_width{ 4 };
+using simd_f32 = __m128;
+
+inline simd_f32 simd_load(const f32* p) { return _mm_load_ps(p); }
+inline void     simd_store(f32* p, simd_f32 v) { _mm_store_ps(p, v); }
+inline simd_f32 simd_set(f32 v) { return _mm_set1_ps(v); }
+inline simd_f32 simd_add(simd_f32 a, simd_f32 b) { return _mm_add_ps(a, b); }
+inline simd_f32 simd_sub(simd_f32 a, simd_f32 b) { return _mm_sub_ps(a, b); }
+inline simd_f32 simd_mul(simd_f32 a, simd_f32 b) { return _mm_mul_ps(a, b); }
+inline simd_f32 simd_div(simd_f32 a, simd_f32 b) { return _mm_div_ps(a, b); }
+#endif
+
+// Paged so that adding transforms never copies the existing ones
+template<typename T>
+using transform_array = utl::chunked_vector<T, 10, utl::tracking_allocator<utl::memory_tag::transforms>>;
+
+transform_array<mat4> to_world;
+transform_array<mat4> inv_world;
+transform_array<vec4> rotations;
+transform_array<vec3> orientations;
+transform_array<vec3> positions;
+transform_array<vec3> scales;
+transform_array<u8>   has_transform;
+transform_array<u8>   changes_from_previous_frame; // flags of the published changes
+transform_array<u8>   pending_changes;             // flags since the last publish_changes
+
+transform_array<id::id_type> transform_ids; // full id at each index, for the change list
+
+utl::vector<id::id_type, false, utl::tracking_allocator<utl::memory_tag::transforms>> pending_indices;
+utl::vector<change, false, utl::tracking_allocator<utl::memory_tag::transforms>>      published_changes;
+
+// Parented transforms sorted by depth, so a parent's world matrices are final before any of its children read them
+struct hierarchy_node
+{
+    id::id_type index;  // of the transform
+    id::id_type parent; // index of its parent
+    u32         dirty;  // the transform or one of its ancestors changed, set by prepare_hierarchy
+};
+
+constexpr u32 orphaned_flag{ 0x8000'0000 }; // set in child_counts when a transform with children is removed
+
+transform_array<id::id_type> parents; // full id of the parent, or invalid_id for roots
+transform_array<u32>         child_counts;
+utl::vector<hierarchy_node, false, utl::tracking_allocator<utl::memory_tag::transforms>> hierarchy;
+bool                                                                                   hierarchy_changed{ false };
+bool                                                                                   has_orphans{ false };
+
+template<typename T>
+void write_array(utl::blob_stream_writer& writer, const transform_array<T>& array)
+{
+    array.for_each_page([&writer](const T* items, u64 count) { writer.write((const u8*) items, count * sizeof(T)); });
+}
+
+template<typename T>
+void read_array(utl::blob_stream_reader& reader, transform_array<T>& array, u64 count)
+{
+    array.resize(count);
+    array.for_each_page([&reader](T* items, u64 page_count) { reader.read((u8*) items, page_count * sizeof(T)); });
+}
+
+template<typename T>
+void fill_array(transform_array<T>& array, u64 count, u8 value)
+{
+    array.resize(count);
+    array.for_each_page([value](T* items, u64 page_count) { memset(items, value, page_count * sizeof(T)); });
+}
+
+// Lists the transform the first time it changes since the last publish, so the list never has duplicates
+void mark_changed(id::id_type index, u8 flags)
+{
+    if (!pending_changes[index])
+    {
+        pending_indices.emplace_back(index);
+    }
+    pending_changes[index] |= flags;
+}
 
 vec3 calculate_orientation(vec4 rotation)
 {
@@ -48,7 +135,8 @@ vec3 calculate_orientation(vec4 rotation)
 }
 
 
-void calculate_transform_matrices(id::id_type index)
+// Matrices of the transform relative to its parent, or its world matrices if it has none
+void calculate_local_matrices(id::id_type index, mat4& world, mat4& inverse_world)
 {
     assert(rotations.size() >= index);
     assert(positions.size() >= index);
@@ -60,41 +148,239 @@ void calculate_transform_matrices(id::id_type index)
     const vec t{ XMLoadFloat3(&positions[index]) };
     const vec s{ XMLoadFloat3(&scales[index]) };
 
-    mat world{ XMMatrixAffineTransformation(s, XMQuaternionIdentity(), r, t) };
-    XMStoreFloat4x4(&to_world[index], world);
-    world.r[3] = XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f);
+    mat local{ XMMatrixAffineTransformation(s, XMQuaternionIdentity(), r, t) };
+    XMStoreFloat4x4(&world, local);
+    local.r[3] = XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f);
 
-    const mat inverse_world{ XMMatrixInverse(nullptr, world) };
-    XMStoreFloat4x4(&inv_world[index], inverse_world);
+    const mat inverse_local{ XMMatrixInverse(nullptr, local) };
+    XMStoreFloat4x4(&inverse_world, inverse_local);
+}
 
+void calculate_transform_matrices(id::id_type index)
+{
+    calculate_local_matrices(index, to_world[index], inv_world[index]);
     has_transform[index] = 1;
 }
 
+// Puts local matrices into the space of the parent. The inverse matrices have no translation, so the inverse of
+// local * parent is parent_inverse * local_inverse
+void compose_with_parent(mat4& world, mat4& inverse_world, const mat4& parent_world, const mat4& parent_inverse_world)
+{
+    using namespace DirectX;
+    XMStoreFloat4x4(&world, XMMatrixMultiply(XMLoadFloat4x4(&world), XMLoadFloat4x4(&parent_world)));
+    XMStoreFloat4x4(&inverse_world,
+                    XMMatrixMultiply(XMLoadFloat4x4(&parent_inverse_world), XMLoadFloat4x4(&inverse_world)));
+}
+
+bool is_ancestor(id::id_type ancestor_index, id::id_type descendant)
+{
+    for (id::id_type at{ descendant }; id::is_valid(at); at = parents[id::index(at)])
+    {
+        if (id::index(at) == ancestor_index)
+            return true;
+    }
+    return false;
+}
+
+// Children of removed transforms become roots. Deferred so removing a whole hierarchy doesn't scan every transform per
+// removed parent, and resolved before an index with orphans can be reused
+void detach_orphans()
+{
+    const u32 count{ (u32) parents.size() };
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        if (id::is_valid(parents[i]) && (child_counts[id::index(parents[i])] & orphaned_flag))
+        {
+            parents[i]       = id::invalid_id;
+            has_transform[i] = 0;
+            mark_changed(i, component_flags::parent);
+        }
+    }
+
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        if (child_counts[i] & orphaned_flag)
+            child_counts[i] = 0;
+    }
+
+    has_orphans = false;
+}
+
+// Depths are found by walking up to the first transform with a known depth and filling in the path on the way back.
+// The parented transforms are then counting sorted by depth
+void sort_hierarchy()
+{
+    if (has_orphans)
+    {
+        detach_orphans();
+    }
+
+    const u32        count{ (u32) parents.size() };
+    utl::vector<u32> depths(count, invalid_id_u32);
+    u32              max_depth{ 0 };
+    u32              node_count{ 0 };
+
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        id::id_type at{ i };
+        u32         length{ 0 };
+        while (depths[at] == invalid_id_u32 && id::is_valid(parents[at]))
+        {
+            at = id::index(parents[at]);
+            ++length;
+        }
+
+        if (depths[at] == invalid_id_u32)
+            depths[at] = 0;
+
+        u32 depth{ depths[at] + length };
+        at = i;
+        for (u32 step{ 0 }; step < length; ++step)
+        {
+            depths[at] = depth--;
+            at         = id::index(parents[at]);
+        }
+
+        if (depths[i])
+        {
+            max_depth = std::max(max_depth, depths[i]);
+            ++node_count;
+        }
+    }
+
+    utl::vector<u32> offsets(max_depth + 1, 0);
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        if (depths[i])
+            ++offsets[depths[i] - 1];
+    }
+
+    u32 offset{ 0 };
+    for (u32 depth{ 0 }; depth < max_depth; ++depth)
+    {
+        const u32 depth_count{ offsets[depth] };
+        offsets[depth] = offset;
+        offset += depth_count;
+    }
+
+    hierarchy.resize(node_count);
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        if (depths[i])
+            hierarchy[offsets[depths[i] - 1]++] = { i, id::index(parents[i]), 1 };
+    }
+
+    hierarchy_changed = false;
+}
+
+// Computes the same matrices as calculate_transform_matrices for up to simd_width transforms at once.
+// world is scale * rotation * translation, so with the translation removed the inverse is rotation^T * scale^-1,
+// which avoids a general 4x4 inverse per transform
+void calculate_transform_matrices_batch(const id::id_type* const indices, u32 count)
+{
+    assert(indices && count && count <= simd_width);
+
+    // SoA staging, unused lanes are filled with an identity transform so they don't produce nans
+    alignas(32) f32 qx[simd_width]{}, qy[simd_width]{}, qz[simd_width]{}, qw[simd_width]{};
+    alignas(32) f32 sx[simd_width]{}, sy[simd_width]{}, sz[simd_width]{};
+    for (u32 i{ 0 }; i < simd_width; ++i)
+    {
+        qw[i] = sx[i] = sy[i] = sz[i] = 1.0f;
+    }
+
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        const id::id_type index{ indices[i] };
+        const vec4&       q{ rotations[index] };
+        const vec3&       s{ scales[index] };
+        qx[i] = q.x;
+        qy[i] = q.y;
+        qz[i] = q.z;
+        qw[i] = q.w;
+        sx[i] = s.x;
+        sy[i] = s.y;
+        sz[i] = s.z;
+    }
+
+    const simd_f32 one{ simd_set(1.0f) };
+    const simd_f32 two{ simd_set(2.0f) };
+    const simd_f32 x{ simd_load(qx) };
+    const simd_f32 y{ simd_load(qy) };
+    const simd_f32 z{ simd_load(qz) };
+    const simd_f32 w{ simd_load(qw) };
+
+    const simd_f32 xx{ simd_mul(x, x) }, yy{ simd_mul(y, y) }, zz{ simd_mul(z, z) };
+    const simd_f32 xy{ simd_mul(x, y) }, xz{ simd_mul(x, z) }, yz{ simd_mul(y, z) };
+    const simd_f32 xw{ simd_mul(x, w) }, yw{ simd_mul(y, w) }, zw{ simd_mul(z, w) };
+
+    // Rotation matrix of the quaternion, same layout as XMMatrixRotationQuaternion
+    alignas(32) f32 r[9][simd_width];
+    simd_store(r[0], simd_sub(one, simd_mul(two, simd_add(yy, zz))));
+    simd_store(r[1], simd_mul(two, simd_add(xy, zw)));
+    simd_store(r[2], simd_mul(two, simd_sub(xz, yw)));
+    simd_store(r[3], simd_mul(two, simd_sub(xy, zw)));
+    simd_store(r[4], simd_sub(one, simd_mul(two, simd_add(xx, zz))));
+    simd_store(r[5], simd_mul(two, simd_add(yz, xw)));
+    simd_store(r[6], simd_mul(two, simd_add(xz, yw)));
+    simd_store(r[7], simd_mul(two, simd_sub(yz, xw)));
+    simd_store(r[8], simd_sub(one, simd_mul(two, simd_add(xx, yy))));
+
+    const simd_f32 scale[3]{ simd_load(sx), simd_load(sy), simd_load(sz) };
+    const simd_f32 inv_scale[3]{ simd_div(one, scale[0]), simd_div(one, scale[1]), simd_div(one, scale[2]) };
+
+    // world[row][col] = scale[row] * r[row][col] and inverse[row][col] = r[col][row] / scale[col]
+    alignas(32) f32 world[9][simd_width];
+    alignas(32) f32 inverse[9][simd_width];
+    for (u32 row{ 0 }; row < 3; ++row)
+    {
+        for (u32 col{ 0 }; col < 3; ++col)
+        {
+            simd_store(world[row * 3 + col], simd_mul(scale[row], simd_load(r[row * 3 + col])));
+            simd_store(inverse[row * 3 + col], simd_mul(inv_scale[col], simd_load(r[col * 3 + row])));
+        }
+    }
+
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        const id::id_type index{ indices[i] };
+        const vec3&       t{ positions[index] };
+
+        to_world[index] = { world[0][i], world[1][i], world[2][i], 0.0f, world[3][i], world[4][i], world[5][i], 0.0f,
+                            world[6][i], world[7][i], world[8][i], 0.0f, t.x,         t.y,         t.z,         1.0f };
+
+        inv_world[index] = { inverse[0][i], inverse[1][i], inverse[2][i], 0.0f, inverse[3][i], inverse[4][i],
+                             inverse[5][i], 0.0f,          inverse[6][i], inverse[7][i], inverse[8][i], 0.0f,
+                             0.0f,          0.0f,          0.0f,          1.0f };
+
+        has_transform[index] = 1;
+    }
+}
+
 void set_rotation(transform_id id, const vec4& rotation_quaternion)
 {
-    const u32 index{ id::index(id) };
+    const id::id_type index{ id::index(id) };
     rotations[index]     = rotation_quaternion;
     orientations[index]  = calculate_orientation(rotation_quaternion);
     has_transform[index] = 0;
-    changes_from_previous_frame[index] |= component_flags::rotation;
+    mark_changed(index, component_flags::rotation);
 }
 
 void set_orientation(transform_id, const vec3&) {}
 
 void set_position(transform_id id, const vec3& position)
 {
-    const u32 index{ id::index(id) };
+    const id::id_type index{ id::index(id) };
     positions[index]     = position;
     has_transform[index] = 0;
-    changes_from_previous_frame[index] |= component_flags::position;
+    mark_changed(index, component_flags::position);
 }
 
 void set_scale(transform_id id, const vec3& scale)
 {
-    const u32 index{ id::index(id) };
+    const id::id_type index{ id::index(id) };
     scales[index]        = scale;
     has_transform[index] = 0;
-    changes_from_previous_frame[index] |= component_flags::scale;
+    mark_changed(index, component_flags::scale);
 }
 
 
@@ -102,17 +388,18 @@ void set_scale(transform_id id, const vec3& scale)
 
 component create(const create_info& info, game_entity::entity entity)
 {
+    assert(!jobs::on_worker_thread());
     assert(entity.is_valid());
 
     if (const id::id_type ent_index = id::index(entity.get_id()); positions.size() > ent_index)
     {
         const vec4 rotation{ info.rotation };
-        rotations[ent_index]                   = rotation;
-        orientations[ent_index]                = calculate_orientation(rotation);
-        positions[ent_index]                   = vec3{ info.position };
-        scales[ent_index]                      = vec3{ info.scale };
-        has_transform[ent_index]               = 0;
-        changes_from_previous_frame[ent_index] = (u8) component_flags::all;
+        rotations[ent_index]     = rotation;
+        orientations[ent_index]  = calculate_orientation(rotation);
+        positions[ent_index]     = vec3{ info.position };
+        scales[ent_index]        = vec3{ info.scale };
+        has_transform[ent_index] = 0;
+        transform_ids[ent_index] = entity.get_id();
     } else
     {
         assert(positions.size() == ent_index);
@@ -123,16 +410,128 @@ component create(const create_info& info, game_entity::entity entity)
         positions.emplace_back(info.position);
         scales.emplace_back(info.scale);
         has_transform.emplace_back((u8) 0);
-        changes_from_previous_frame.emplace_back((u8) component_flags::all);
+        changes_from_previous_frame.emplace_back((u8) 0);
+        pending_changes.emplace_back((u8) 0);
+        transform_ids.emplace_back(entity.get_id());
+        parents.emplace_back(id::invalid_id);
+        child_counts.emplace_back(0u);
+    }
+    mark_changed(id::index(entity.get_id()), component_flags::all);
+
+    if (has_orphans)
+    {
+        detach_orphans();
     }
+    assert(!id::is_valid(parents[id::index(entity.get_id())]) && !child_counts[id::index(entity.get_id())]);
 
     // returns the entity ID because since every entity has a transform component, the ids are the same
     return component(transform_id{ entity.get_id() });
 }
 
-void remove([[maybe_unused]] const component comp)
+void create_batch(const game_entity::create_info* const infos, const game_entity::entity* const entities, u32 count,
+                  component* const out)
 {
+    assert(!jobs::on_worker_thread());
+    assert(infos && entities && count && out);
+
+    id::id_type max_index{ 0 };
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        assert(entities[i].is_valid() && infos[i].transform);
+        max_index = std::max(max_index, id::index(entities[i].get_id()));
+    }
+
+    if (positions.size() <= max_index)
+    {
+        const u64 new_size{ (u64) max_index + 1 };
+        to_world.resize(new_size);
+        inv_world.resize(new_size);
+        rotations.resize(new_size);
+        orientations.resize(new_size);
+        positions.resize(new_size);
+        scales.resize(new_size);
+        has_transform.resize(new_size);
+        changes_from_previous_frame.resize(new_size, (u8) 0);
+        pending_changes.resize(new_size, (u8) 0);
+        transform_ids.resize(new_size, id::invalid_id);
+        parents.resize(new_size, id::invalid_id);
+        child_counts.resize(new_size, 0u);
+    }
+
+    if (has_orphans)
+    {
+        detach_orphans();
+    }
+
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        const create_info& info{ *infos[i].transform };
+        const id::id_type  index{ id::index(entities[i].get_id()) };
+        rotations[index] = vec4{ info.rotation };
+        positions[index] = vec3{ info.position };
+        scales[index]    = vec3{ info.scale };
+    }
+
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        const id::id_type index{ id::index(entities[i].get_id()) };
+        orientations[index]  = calculate_orientation(rotations[index]);
+        has_transform[index] = 0;
+        transform_ids[index] = entities[i].get_id();
+        out[i]               = component{ transform_id{ entities[i].get_id() } };
+        mark_changed(index, component_flags::all);
+    }
+}
+
+void remove(const component comp)
+{
+    assert(!jobs::on_worker_thread());
     assert(comp.is_valid());
+    const id::id_type index{ id::index(comp.get_id()) };
+
+    if (id::is_valid(parents[index]))
+    {
+        --child_counts[id::index(parents[index])];
+        parents[index]    = id::invalid_id;
+        hierarchy_changed = true;
+    }
+
+    if (child_counts[index])
+    {
+        child_counts[index] |= orphaned_flag;
+        has_orphans       = true;
+        hierarchy_changed = true;
+    }
+}
+
+void set_parent(const component child, const component parent)
+{
+    assert(!jobs::on_worker_thread());
+    assert(child.is_valid());
+    const id::id_type index{ id::index(child.get_id()) };
+    assert(!parent.is_valid() || !is_ancestor(index, parent.get_id()));
+
+    if (id::is_valid(parents[index]))
+    {
+        --child_counts[id::index(parents[index])];
+    }
+
+    parents[index] = parent.is_valid() ? parent.get_id() : id::invalid_id;
+    if (parent.is_valid())
+    {
+        ++child_counts[id::index(parent.get_id())];
+    }
+
+    has_transform[index] = 0;
+    hierarchy_changed    = true;
+    mark_changed(index, component_flags::parent);
+}
+
+component get_parent(const component child)
+{
+    assert(child.is_valid());
+    const id::id_type parent{ parents[id::index(child.get_id())] };
+    return id::is_valid(parent) ? component{ transform_id{ parent } } : component{};
 }
 
 
@@ -140,9 +539,46 @@ void get_transform_matrices(const game_entity::entity_id id, mat4& world, mat4&
 {
     assert(game_entity::entity{ id }.is_valid());
 
+    // Normally computed in bulk by update_matrices. This only catches transforms changed after that ran this frame,
+    // the entity's own or an ancestor's, since children are only marked dirty by update_matrices
     const id::id_type ent_idx{ id::index(id) };
-    if (!has_transform[ent_idx])
+
+    // A clean ancestor's matrices are stale too if anything above it changed, so only the lowest ancestor with nothing
+    // dirty on its path to the root can be used as is
+    id::id_type clean{ id::invalid_id };
+    for (id::id_type parent{ parents[ent_idx] }; id::is_valid(parent); parent = parents[id::index(parent)])
     {
+        if (!has_transform[id::index(parent)])
+        {
+            clean = id::invalid_id;
+        } else if (!id::is_valid(clean))
+        {
+            clean = parent;
+        }
+    }
+
+    if (!has_transform[ent_idx] || clean != parents[ent_idx])
+    {
+        // Left dirty when part of a hierarchy, so update_matrices still refreshes the whole subtree next frame
+        if (id::is_valid(parents[ent_idx]) || child_counts[ent_idx])
+        {
+            calculate_local_matrices(ent_idx, world, inverse_world);
+            for (id::id_type parent{ parents[ent_idx] }; id::is_valid(parent); parent = parents[id::index(parent)])
+            {
+                const id::id_type parent_idx{ id::index(parent) };
+                if (parent == clean)
+                {
+                    compose_with_parent(world, inverse_world, to_world[parent_idx], inv_world[parent_idx]);
+                    break;
+                }
+
+                mat4 parent_world, parent_inverse_world;
+                calculate_local_matrices(parent_idx, parent_world, parent_inverse_world);
+                compose_with_parent(world, inverse_world, parent_world, parent_inverse_world);
+            }
+            return;
+        }
+
         calculate_transform_matrices(ent_idx);
     }
 
@@ -150,11 +586,156 @@ void get_transform_matrices(const game_entity::entity_id id, mat4& world, mat4&
     inverse_world = inv_world[ent_idx];
 }
 
+u32 transform_count()
+{
+    return (u32) has_transform.size();
+}
+
+u64 snapshot_size()
+{
+    return snapshot_size((u32) positions.size());
+}
+
+u64 snapshot_size(const u32 count)
+{
+    constexpr u64 bytes_per_transform{ sizeof(vec4) + 3 * sizeof(vec3) + 2 * sizeof(id::id_type) + sizeof(u32) };
+    return sizeof(u32) + count * bytes_per_transform;
+}
+
+void write_snapshot(utl::blob_stream_writer& writer)
+{
+    // Saved without orphans, so they never have to be looked for after loading
+    if (has_orphans)
+    {
+        detach_orphans();
+    }
+
+    writer.write((u32) positions.size());
+    write_array(writer, rotations);
+    write_array(writer, orientations);
+    write_array(writer, positions);
+    write_array(writer, scales);
+    write_array(writer, transform_ids);
+    write_array(writer, parents);
+    write_array(writer, child_counts);
+}
+
+void read_snapshot(utl::blob_stream_reader& reader)
+{
+    const u64 count{ reader.read<u32>() };
+    read_array(reader, rotations, count);
+    read_array(reader, orientations, count);
+    read_array(reader, positions, count);
+    read_array(reader, scales, count);
+    read_array(reader, transform_ids, count);
+    read_array(reader, parents, count);
+    read_array(reader, child_counts, count);
+
+    to_world.resize(count);
+    inv_world.resize(count);
+    fill_array(has_transform, count, 0);
+    fill_array(changes_from_previous_frame, count, 0);
+    fill_array(pending_changes, count, component_flags::all);
+
+    // Changes of removed transforms are allowed in the list, so every index is listed rather than only the live ones
+    pending_indices.resize(count);
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        pending_indices[i] = i;
+    }
+    published_changes.clear();
+
+    hierarchy.clear();
+    hierarchy_changed = true;
+    has_orphans       = false;
+}
+
+void update_matrices()
+{
+    prepare_hierarchy();
+    update_matrices(0, transform_count());
+    propagate_hierarchy();
+}
+
+// Marks every transform under a changed one as changed too. Ancestors come first, so one pass reaches the whole subtree
+void prepare_hierarchy()
+{
+    if (hierarchy_changed)
+    {
+        sort_hierarchy();
+    }
+
+    for (u32 i{ 0 }; i < hierarchy.size(); ++i)
+    {
+        hierarchy_node& node{ hierarchy[i] };
+        if (!has_transform[node.parent])
+        {
+            has_transform[node.index] = 0;
+        }
+        node.dirty = !has_transform[node.index];
+    }
+}
+
+// At this point dirty transforms hold their local matrices and their parents already hold world matrices
+void propagate_hierarchy()
+{
+    for (u32 i{ 0 }; i < hierarchy.size(); ++i)
+    {
+        hierarchy_node& node{ hierarchy[i] };
+        if (!node.dirty)
+            continue;
+
+        compose_with_parent(to_world[node.index], inv_world[node.index], to_world[node.parent], inv_world[node.parent]);
+        mark_changed(node.index, component_flags::parent);
+        node.dirty = 0;
+    }
+}
+
+void update_matrices(u32 first, u32 last)
+{
+    assert(first <= last && last <= has_transform.size());
+
+    id::id_type batch[simd_width];
+    u32         batch_count{ 0 };
+
+    u32 i{ first };
+    while (i < last)
+    {
+        // Most transforms don't change every frame, so skip 8 clean ones at a time. Pages hold a multiple of 8 flags, so
+        // 8 flags starting at a multiple of 8 never cross into the next page
+        if (!(i & 7) && i + 8 <= last)
+        {
+            u64 flags;
+            memcpy(&flags, &has_transform[i], sizeof(u64));
+            if (flags == 0x0101010101010101ull)
+            {
+                i += 8;
+                continue;
+            }
+        }
+
+        if (!has_transform[i])
+        {
+            batch[batch_count++] = i;
+            if (batch_count == simd_width)
+            {
+                calculate_transform_matrices_batch(&batch[0], batch_count);
+                batch_count = 0;
+            }
+        }
+
+        ++i;
+    }
+
+    if (batch_count)
+    {
+        calculate_transform_matrices_batch(&batch[0], batch_count);
+    }
+}
+
 void get_updated_components_flags(const game_entity::entity_id* const ids, u32 count, u8* const flags)
 {
     assert(ids && count && flags);
-    read_write_flag = 1;
-
 
     for (u32 i = 0; i < count; ++i)
     {
@@ -166,14 +747,6 @@ void get_updated_components_flags(const game_entity::entity_id* const ids, u32 c
 void update(const component_cache* const cache, u32 count)
 {
     assert(cache && count);
-    // NOTE: Clearing changes_from_previous_frame happens once each frame when there will
-    // be no reads and the caches are about to be applied by calling this function -
-    //  -- in other words, the rest of the frame will only have writes
-    if (read_write_flag)
-    {
-        memset(changes_from_previous_frame.data(), 0, changes_from_previous_frame.size());
-        read_write_flag = 0;
-    }
 
     for (u32 i = 0; i < count; ++i)
     {
@@ -198,6 +771,32 @@ void update(const component_cache* const cache, u32 count)
 }
 
 
+// Only the entries of the previous and the new list are touched, never the whole flag arrays
+void publish_changes()
+{
+    for (u32 i{ 0 }; i < published_changes.size(); ++i)
+    {
+        changes_from_previous_frame[id::index(published_changes[i].id)] = 0;
+    }
+
+    published_changes.resize(pending_indices.size());
+    for (u32 i{ 0 }; i < pending_indices.size(); ++i)
+    {
+        const id::id_type index{ pending_indices[i] };
+        published_changes[i]               = { transform_id{ transform_ids[index] }, pending_changes[index] };
+        changes_from_previous_frame[index] = pending_changes[index];
+        pending_changes[index]             = 0;
+    }
+
+    pending_indices.clear();
+}
+
+void get_changes(const change*& changes, u32& count)
+{
+    changes = published_changes.data();
+    count   = (u32) published_changes.size();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // TransformComponent Class Implementations ////////////////////////////////////////////////////////////////////////////
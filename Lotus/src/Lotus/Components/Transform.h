@@ -23,6 +23,16 @@
 #pragma once
 #include "Components.h"
 
+namespace lotus::game_entity
+{
+struct create_info;
+} // namespace lotus::game_entity
+
+namespace lotus::utl
+{
+class blob_stream_reader;
+class blob_stream_writer;
+} // namespace lotus::utl
 
 namespace lotus::transform
 {
@@ -42,11 +52,18 @@ struct component_flags
         orientation = 0x02,
         position    = 0x04,
         scale       = 0x08,
+        parent      = 0x10, // only in published changes, the world matrices moved with an ancestor
 
         all = rotation | orientation | position | scale
     };
 };
 
+struct change
+{
+    transform_id id;
+    u32          flags; // component_flags
+};
+
 struct component_cache
 {
     vec4         rotation;
@@ -58,9 +75,42 @@ struct component_cache
 };
 
 component create(const create_info& info, game_entity::entity entity);
+// Same as calling create for each entity, but grows the transform arrays once and fills them with straight loops.
+// infos[i].transform describes the transform of entities[i]
+void create_batch(const game_entity::create_info* const infos, const game_entity::entity* const entities, u32 count,
+                  component* const out);
 void      remove(component comp);
 void      get_transform_matrices(const game_entity::entity_id id, mat4& world, mat4& inverse_world);
 void      get_updated_components_flags(const game_entity::entity_id* const ids, u32 count, u8* const flags);
 void      update(const component_cache* const cache, u32 count);
 
+// Makes the transforms changed since the previous call the published changes, once per frame after update_matrices.
+// get_changes lists each of them once with all of their flags, so consumers only visit what moved. The list stays
+// valid until the next publish and can hold transforms that were removed since
+void publish_changes();
+void get_changes(const change*& changes, u32& count);
+
+// The transform of a child is relative to its parent. An invalid parent makes child a root again.
+// When a parent is removed its children become roots and keep their local transform as their world transform
+void                    set_parent(component child, component parent);
+[[nodiscard]] component get_parent(component child);
+
+// Computes world and inverse world matrices for every transform that changed since its matrices were last computed,
+// parented transforms are then composed with their parent's matrices.
+// update_matrices() is the same as prepare_hierarchy(), update_matrices(0, transform_count()), propagate_hierarchy().
+// The ranged version only touches transforms in [first, last), so disjoint ranges can be updated on different threads
+void              update_matrices();
+void              update_matrices(u32 first, u32 last);
+void              prepare_hierarchy();
+void              propagate_hierarchy();
+[[nodiscard]] u32 transform_count();
+
+// Part of a world snapshot. The local transforms and parents of every index are saved, the matrices aren't, so after
+// read_snapshot every transform is recomputed by the next update_matrices and listed as changed at the next publish
+[[nodiscard]] u64 snapshot_size();
+// Size of the transform part of a snapshot that holds count transforms
+[[nodiscard]] u64 snapshot_size(u32 count);
+void              write_snapshot(utl::blob_stream_writer& writer);
+void              read_snapshot(utl::blob_stream_reader& reader);
+
 } // namespace lotus::transform
@@ -142,9 +142,15 @@ bool load_game()
     if (!num_ents)
         return false;
 
+    // The readers fill the shared transform_info and script_info, so copy them out per entity and create all of them
+    // in one batch once the file is parsed
+    utl::vector<game_entity::create_info> infos(num_ents);
+    utl::vector<transform::create_info>   transform_infos(num_ents);
+    utl::vector<script::create_info>      script_infos(num_ents);
+
     for (u32 i = 0; i < num_ents; ++i)
     {
-        game_entity::create_info info;
+        game_entity::create_info& info{ infos[i] };
         //         const u32           entity_type = *at; // TODO
         at += size32;
         const u32 comp_count = *at;
@@ -165,21 +171,29 @@ bool load_game()
         }
 
         assert(info.transform);
-        game_entity::entity ent(game_entity::create(info));
-        if (!ent.is_valid())
-            return false;
-        entities.emplace_back(ent);
+        transform_infos[i] = *info.transform;
+        info.transform     = &transform_infos[i];
+        if (info.script)
+        {
+            script_infos[i] = *info.script;
+            info.script     = &script_infos[i];
+        }
     }
 
     assert(at == game_data.get() + size);
+
+    const u64 first{ entities.size() };
+    entities.resize(first + num_ents);
+    game_entity::create_batch(infos.data(), num_ents, &entities[first]);
     return true;
 }
 
 void unload_game()
 {
-    for (auto ent : entities)
+    if (!entities.empty())
     {
-        game_entity::remove(ent.get_id());
+        game_entity::remove_batch(entities.data(), (u32) entities.size());
+        entities.clear();
     }
 }
 
@@ -100,14 +100,13 @@ struct noexcept_map
 // Indicates an element in geometry_hiarchies is a fake pointer and is actually a gpu_id
 constexpr uintptr_t single_mesh_marker = (uintptr_t) 0x01;
 
-utl::free_list<u8*> geometry_hierarchies;
-std::mutex          geometry_mutex;
+// Read by the render thread every frame while content is streamed in and out on other threads
+utl::concurrent_free_list<u8*> geometry_hierarchies;
 
 
 
 
-utl::free_list<noexcept_map> shader_groups;
-std::mutex                   shader_mutex;
+utl::concurrent_free_list<noexcept_map> shader_groups;
 
 u32 get_geometry_hierarchy_size(const void* const data)
 {
@@ -172,8 +171,6 @@ id::id_type create_mesh_hierarchy(const void* const data)
 
     static_assert(alignof(void*) > 2, "The least significant bit is needed for the single_mesh_marker");
 
-    std::lock_guard lock(geometry_mutex);
-
     return geometry_hierarchies.add(hierarchy_buffer);
 }
 
@@ -212,7 +209,6 @@ id::id_type create_single_submesh(const void* const data)
     constexpr u8 shift_bits = (sizeof(uintptr_t) - sizeof(id::id_type)) << 3;
     u8* const    fake_ptr   = (u8* const) (((uintptr_t) gpu_id << shift_bits) | single_mesh_marker);
 
-    std::lock_guard lock(geometry_mutex);
     return geometry_hierarchies.add(fake_ptr);
 }
 
@@ -261,8 +257,6 @@ constexpr id::id_type gpu_id_from_fake_pointer(u8* const pointer)
 
 void destroy_geometry_resource(id::id_type id)
 {
-    std::lock_guard lock(geometry_mutex);
-
     u8* const pointer = geometry_hierarchies[id];
     // If the pointer is fake
     if ((uintptr_t) pointer & single_mesh_marker)
@@ -312,7 +306,7 @@ void destroy_material_resource(id::id_type id)
 id::id_type create_resource(const void* const data, asset_type::type type)
 {
     assert(data);
-    id::id_type id = invalid_id_u32;
+    id::id_type id = id::invalid_id;
 
     switch (type)
     {
@@ -357,14 +351,11 @@ id::id_type add_shader_group(const u8** shaders, u32 num_shaders, const u32* con
         group.map[keys[i]] = std::move(shader);
     }
 
-
-    std::lock_guard lock(shader_mutex);
     return shader_groups.add(std::move(group));
 }
 
 void remove_shader_group(id::id_type id)
 {
-    std::lock_guard lock(shader_mutex);
     assert(id::is_valid(id));
     shader_groups[id].map.clear();
     shader_groups.remove(id);
@@ -372,7 +363,6 @@ void remove_shader_group(id::id_type id)
 
 compiled_shader_ptr get_shader(id::id_type id, u32 shader_key)
 {
-    std::lock_guard lock(shader_mutex);
     assert(id::is_valid(id));
 
     for (const auto& [key, value] : shader_groups[id].map)
@@ -389,8 +379,6 @@ compiled_shader_ptr get_shader(id::id_type id, u32 shader_key)
 
 void get_submesh_gpu_ids(id::id_type geometry_content_id, u32 id_count, id::id_type* const gpu_ids)
 {
-    std::lock_guard lock(geometry_mutex);
-
     u8* const ptr = geometry_hierarchies[geometry_content_id];
     if ((uintptr_t) ptr & single_mesh_marker)
     {
@@ -412,24 +400,22 @@ void get_submesh_gpu_ids(id::id_type geometry_content_id, u32 id_count, id::id_t
 }
 
 void get_lod_offsets(const id::id_type* const geometry_ids, const f32* const thresholds, u32 id_count,
-                     utl::vector<lod_offset>& offsets)
+                     lod_offset* const offsets)
 {
-    assert(geometry_ids && thresholds && id_count);
-    assert(offsets.empty());
+    assert(geometry_ids && thresholds && id_count && offsets);
 
-    std::lock_guard lock(geometry_mutex);
     for (u32 i = 0; i < id_count; ++i)
     {
         u8* const ptr = geometry_hierarchies[geometry_ids[i]];
         if ((uintptr_t) ptr & single_mesh_marker)
         {
             //assert(id_count == 1);
-            offsets.emplace_back(lod_offset{ 0, 1 });
+            offsets[i] = lod_offset{ 0, 1 };
         } else
         {
             geometry_hiearchy_stream stream{ ptr };
             const u32                lod = stream.lod_from_threshold(thresholds[i]);
-            offsets.emplace_back(stream.lod_offsets()[lod]);
+            offsets[i] = stream.lod_offsets()[lod];
         }
     }
 }
@@ -25,6 +25,7 @@
 
     #include "Content/ContentLoader.h"
     #include "Components/Script.h"
+    #include "Core/JobSystem.h"
     #include "Platform/Platform.h"
     #include "Graphics/Renderer.h"
 
@@ -68,9 +69,14 @@ LRESULT winproc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam)
 bool engine_initialize()
 {
     LOG_INFO("Initializing Lotus engine");
+    jobs::initialize();
+    LOG_INFO("Started job system with {} threads", jobs::thread_count());
     LOG_INFO("Loading game");
     if (!content::load_game())
+    {
+        jobs::shutdown();
         return false;
+    }
 
     constexpr platform::window_create_info info{ &winproc, nullptr, L"Lotus Game" };
     LOG_INFO("Setting up platform");
@@ -79,6 +85,7 @@ bool engine_initialize()
     if (!game_window.window.is_valid())
     {
         LOG_ERROR("Failed to create window");
+        jobs::shutdown();
         return false;
     }
 
@@ -96,6 +103,16 @@ void engine_shutdown()
     platform::remove_window(game_window.window.get_id());
     LOG_INFO("Unloading game");
     content::unload_game();
+    script::shutdown();
+    jobs::shutdown();
+
+    for (u32 i{ 0 }; i < utl::memory_tag::count; ++i)
+    {
+        const auto              tag{ (utl::memory_tag::type) i };
+        const utl::memory_stats stats{ utl::get_memory_stats(tag) };
+        LOG_INFO("Memory [{}]: {} bytes live in {} blocks, {} bytes peak, {} allocations", utl::memory_tag_name(tag),
+                 stats.live_bytes, stats.live_allocations, stats.peak_bytes, stats.allocation_count);
+    }
 }
 
 #endif
@@ -25,52 +25,91 @@
 #include "Common.h"
 #include "Types.h"
 
+#include <concepts>
+#include <type_traits>
+
+// Underlying id integer and how many of its high bits hold the generation. Override both from the build
+// (e.g. L_ID_TYPE=u64 and L_ID_GENERATION_BITS=24) for very large worlds or high churn spawners
+#ifndef L_ID_TYPE
+    #define L_ID_TYPE u32
+#endif
+
+#ifndef L_ID_GENERATION_BITS
+    #define L_ID_GENERATION_BITS 10
+#endif
+
 
 namespace lotus::id
 {
 
-using id_type = u32;
-constexpr size_t size = sizeof(id_type);
-
 namespace detail
 {
-constexpr u32     generation_bits = 10;
-constexpr u32     index_bits      = sizeof(id_type) * 8 - generation_bits;
-constexpr id_type index_mask      = (id_type{ 1 } << index_bits) - 1;
-constexpr id_type generation_mask = (id_type{ 1 } << generation_bits) - 1;
+template<u32 bits>
+using uint_for_bits =
+    std::conditional_t<bits <= 8, u8, std::conditional_t<bits <= 16, u16, std::conditional_t<bits <= 32, u32, u64>>>;
 } // namespace detail
 
-#pragma warning(disable : 4245)
-constexpr id_type invalid_id           = -1;
-constexpr u32     min_deleted_elements = 1024;
+// Generational id packed into T, the low index_bits are the slot index and the high generation_bits count its reuses
+template<std::unsigned_integral T, u32 GenerationBits>
+struct basic_id
+{
+    using id_type  = T;
+    using gen_type = detail::uint_for_bits<GenerationBits>;
+
+    constexpr static u32     generation_bits{ GenerationBits };
+    constexpr static u32     index_bits{ sizeof(id_type) * 8 - generation_bits };
+    constexpr static id_type index_mask{ (id_type) ((id_type{ 1 } << index_bits) - 1) };
+    constexpr static id_type generation_mask{ (id_type) ((id_type{ 1 } << generation_bits) - 1) };
+    constexpr static id_type invalid_id{ (id_type) ~id_type{ 0 } };
+
+    static_assert(generation_bits > 0 && index_bits > 0);
+    static_assert(sizeof(gen_type) * 8 >= generation_bits);
+    static_assert(sizeof(id_type) - sizeof(gen_type) > 0);
+
+    constexpr static bool is_valid(const id_type id) { return id != invalid_id; }
+
+    constexpr static id_type index(const id_type id)
+    {
+        assert((id & index_mask) != index_mask);
+        return id & index_mask;
+    }
+
+    constexpr static id_type generation(const id_type id) { return (id >> index_bits) & generation_mask; }
+
+    constexpr static id_type new_generation(const id_type id)
+    {
+        const id_type gen = generation(id) + 1;
+        assert(gen < generation_mask);
+        return index(id) | (id_type) (gen << index_bits);
+    }
+};
 
-using gen_type =
-    std::conditional_t<detail::generation_bits <= 16, std::conditional_t<detail::generation_bits <= 8, u8, u16>, u32>;
+using traits   = basic_id<L_ID_TYPE, L_ID_GENERATION_BITS>;
+using id_type  = traits::id_type;
+using gen_type = traits::gen_type;
 
-static_assert(sizeof(gen_type) * 8 >= detail::generation_bits);
-static_assert(sizeof(id_type) - sizeof(gen_type) > 0);
+constexpr size_t  size                 = sizeof(id_type);
+constexpr id_type invalid_id           = traits::invalid_id;
+constexpr u32     min_deleted_elements = 1024;
 
 constexpr bool is_valid(const id_type id)
 {
-    return id != invalid_id;
+    return traits::is_valid(id);
 }
 
 constexpr id_type index(const id_type id)
 {
-    assert((id & detail::index_mask) != detail::index_mask);
-    return id & detail::index_mask;
+    return traits::index(id);
 }
 
 constexpr id_type generation(const id_type id)
 {
-    return (id >> detail::index_bits) & detail::generation_mask;
+    return traits::generation(id);
 }
 
 constexpr id_type new_generation(const id_type id)
 {
-    const id_type gen = generation(id) + 1;
-    assert(gen < ((u64) 1 << detail::generation_bits) - 1);
-    return index(id) | (gen << detail::index_bits);
+    return traits::new_generation(id);
 }
 
 
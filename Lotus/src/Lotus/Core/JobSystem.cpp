@@ -0,0 +1,353 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: JobSystem.cpp
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+#include "JobSystem.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace lotus::jobs
+{
+namespace
+{
+
+// Chase-Lev deque. The owning worker pushes and pops at the bottom, any other thread steals from the top
+class work_stealing_deque
+{
+public:
+    constexpr static u32 capacity{ 4096 };
+
+    // Only the owner. Returns false when full
+    bool push(const job& j)
+    {
+        const i64 bottom{ m_bottom.load(std::memory_order_relaxed) };
+        const i64 top{ m_top.load(std::memory_order_acquire) };
+        if (bottom - top >= capacity)
+            return false;
+
+        m_slots[bottom & mask].store(j);
+        m_bottom.store(bottom + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Only the owner
+    bool pop(job& j)
+    {
+        const i64 bottom{ m_bottom.load(std::memory_order_relaxed) - 1 };
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        i64 top{ m_top.load(std::memory_order_relaxed) };
+
+        if (top > bottom)
+        {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        j = m_slots[bottom & mask].load();
+        if (top == bottom)
+        {
+            // Last job, a thief may be taking it too
+            const bool won{ m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                          std::memory_order_relaxed) };
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+
+        return true;
+    }
+
+    bool steal(job& j)
+    {
+        i64 top{ m_top.load(std::memory_order_acquire) };
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const i64 bottom{ m_bottom.load(std::memory_order_acquire) };
+        if (top >= bottom)
+            return false;
+
+        j = m_slots[top & mask].load();
+        return m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+private:
+    constexpr static i64 mask{ capacity - 1 };
+    static_assert((capacity & (capacity - 1)) == 0);
+
+    // A thief can read a slot the owner is overwriting, its compare exchange then fails and it drops what it read.
+    // Relaxed atomics make that read well defined and compile to plain moves
+    struct slot
+    {
+        std::atomic<job_function>   func;
+        std::atomic<void*>          data;
+        std::atomic<counter*>       done;
+        std::atomic<const counter*> depends_on;
+
+        void store(const job& j)
+        {
+            func.store(j.func, std::memory_order_relaxed);
+            data.store(j.data, std::memory_order_relaxed);
+            done.store(j.done, std::memory_order_relaxed);
+            depends_on.store(j.depends_on, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] job load() const
+        {
+            return { func.load(std::memory_order_relaxed), data.load(std::memory_order_relaxed),
+                     done.load(std::memory_order_relaxed), depends_on.load(std::memory_order_relaxed) };
+        }
+    };
+
+    alignas(64) std::atomic<i64> m_top{ 0 };
+    alignas(64) std::atomic<i64> m_bottom{ 0 };
+    alignas(64) slot m_slots[capacity]{};
+};
+
+utl::vector<std::thread>          threads;
+scope<work_stealing_deque[]>      deques; // one per thread, index 0 belongs to the thread that called initialize
+u32                               deque_count{ 0 };
+thread_local u32                  current_index{ invalid_id_u32 };
+std::atomic<bool>                 running{ false };
+std::atomic<bool>                 quit{ false };
+
+// Jobs queued by threads without a deque
+std::mutex       injected_mutex;
+utl::deque<job>  injected_jobs;
+std::atomic<u32> injected_count{ 0 };
+
+// Sleeping workers are woken when a job is queued. queued_count is bumped before sleepers is read, and read after
+// sleepers is bumped, so either the worker sees the job or the queueing thread sees the worker
+std::mutex              sleep_mutex;
+std::condition_variable wake;
+std::atomic<u32>        queued_count{ 0 };
+std::atomic<u32>        sleepers{ 0 };
+
+void execute(const job& j)
+{
+    queued_count.fetch_sub(1, std::memory_order_relaxed);
+    if (j.depends_on)
+    {
+        wait(*j.depends_on);
+    }
+
+    j.func(j.data);
+
+    if (j.done)
+    {
+        j.done->fetch_sub(1, std::memory_order_release);
+    }
+}
+
+bool take_injected(job& j)
+{
+    if (!injected_count.load(std::memory_order_acquire))
+        return false;
+
+    std::lock_guard lock{ injected_mutex };
+    if (injected_jobs.empty())
+        return false;
+
+    j = injected_jobs.front();
+    injected_jobs.pop_front();
+    injected_count.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+// Own deque first, newest job first since its data is most likely still in cache. Then jobs from other threads, then
+// the oldest job of another worker, starting after this one so thieves don't all hit worker 0
+bool find_job(job& j)
+{
+    const u32 index{ current_index };
+    if (index < deque_count && deques[index].pop(j))
+        return true;
+
+    if (take_injected(j))
+        return true;
+
+    const u32 start{ index < deque_count ? index + 1 : 0 };
+    for (u32 i{ 0 }; i < deque_count; ++i)
+    {
+        const u32 victim{ (start + i) % deque_count };
+        if (victim != index && deques[victim].steal(j))
+            return true;
+    }
+
+    return false;
+}
+
+void notify_workers()
+{
+    if (sleepers.load(std::memory_order_seq_cst))
+    {
+        {
+            std::lock_guard lock{ sleep_mutex };
+        }
+        wake.notify_all();
+    }
+}
+
+void worker_loop(u32 index)
+{
+    current_index = index;
+    job j;
+    while (!quit.load(std::memory_order_relaxed))
+    {
+        if (find_job(j))
+        {
+            execute(j);
+            continue;
+        }
+
+        // Spin a little before sleeping, jobs are often queued in quick succession
+        bool found{ false };
+        for (u32 spin{ 0 }; spin < 64 && !found; ++spin)
+        {
+            std::this_thread::yield();
+            found = queued_count.load(std::memory_order_relaxed) != 0;
+        }
+        if (found)
+            continue;
+
+        std::unique_lock lock{ sleep_mutex };
+        sleepers.fetch_add(1, std::memory_order_seq_cst);
+        wake.wait(lock, [] { return quit.load(std::memory_order_relaxed) || queued_count.load(std::memory_order_seq_cst); });
+        sleepers.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+} // anonymous namespace
+
+void initialize(u32 worker_count)
+{
+    assert(!running);
+    if (!worker_count)
+    {
+        worker_count = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+    }
+
+    deque_count = worker_count + 1;
+    deques      = create_scope<work_stealing_deque[]>(deque_count);
+    quit        = false;
+
+    current_index = 0;
+    for (u32 i{ 1 }; i < deque_count; ++i)
+    {
+        threads.emplace_back([i] { worker_loop(i); });
+    }
+
+    running = true;
+}
+
+void shutdown()
+{
+    if (!running)
+        return;
+
+    quit = true;
+    {
+        std::lock_guard lock{ sleep_mutex };
+    }
+    wake.notify_all();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    threads.clear();
+
+    assert(!queued_count);
+    running       = false;
+    current_index = invalid_id_u32;
+    deques.reset();
+    deque_count = 0;
+}
+
+u32 thread_count()
+{
+    return running ? deque_count : 1;
+}
+
+u32 thread_index()
+{
+    return current_index;
+}
+
+void run(const job* const jobs, u32 count)
+{
+    assert(jobs && count);
+
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        if (jobs[i].done)
+        {
+            jobs[i].done->fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (!running)
+    {
+        for (u32 i{ 0 }; i < count; ++i)
+        {
+            queued_count.fetch_add(1, std::memory_order_relaxed);
+            execute(jobs[i]);
+        }
+        return;
+    }
+
+    const u32 index{ current_index };
+    for (u32 i{ 0 }; i < count; ++i)
+    {
+        queued_count.fetch_add(1, std::memory_order_seq_cst);
+        if (index < deque_count)
+        {
+            // A full deque means this thread is far ahead of the others, so doing the job now costs nothing
+            if (!deques[index].push(jobs[i]))
+            {
+                execute(jobs[i]);
+            }
+        } else
+        {
+            std::lock_guard lock{ injected_mutex };
+            injected_jobs.push_back(jobs[i]);
+            injected_count.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    notify_workers();
+}
+
+void wait(const counter& c)
+{
+    job j;
+    while (c.load(std::memory_order_acquire))
+    {
+        if (find_job(j))
+        {
+            execute(j);
+        } else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+} // namespace lotus::jobs
@@ -0,0 +1,116 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: JobSystem.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "../Common.h"
+
+#include <atomic>
+
+namespace lotus::jobs
+{
+
+// Jobs given a counter add one to it when they are queued and remove one when they are done
+using counter      = std::atomic<u32>;
+using job_function = void (*)(void* data);
+
+struct job
+{
+    job_function   func{ nullptr };
+    void*          data{ nullptr };       // must stay alive until the job is done
+    counter*       done{ nullptr };       // optional
+    const counter* depends_on{ nullptr }; // optional, the job waits for it to reach zero before it runs
+};
+
+// Starts worker_count threads besides the calling thread, which becomes worker 0. 0 uses one per hardware thread.
+// Until this is called, and after shutdown, run executes jobs on the spot
+void initialize(u32 worker_count = 0);
+void shutdown();
+
+// Including the thread that called initialize
+[[nodiscard]] u32 thread_count();
+// Index of the calling worker in [0, thread_count()), invalid_id_u32 for threads the job system didn't start
+[[nodiscard]] u32 thread_index();
+// True on the threads initialize started, false on the one that called it and on threads the job system didn't start
+[[nodiscard]] inline bool on_worker_thread()
+{
+    const u32 index{ thread_index() };
+    return index != 0 && index != invalid_id_u32;
+}
+
+void run(const job* jobs, u32 count);
+// Runs queued jobs on the calling thread until the counter reaches zero, so waiting inside a job can't deadlock
+void wait(const counter& c);
+
+namespace detail
+{
+template<typename Func>
+struct range_job
+{
+    Func*            func;
+    std::atomic<u32> next;
+    u32              count;
+    u32              batch_size;
+
+    static void execute(void* data)
+    {
+        range_job& r{ *(range_job*) data };
+        for (u32 first{ r.next.fetch_add(r.batch_size) }; first < r.count; first = r.next.fetch_add(r.batch_size))
+        {
+            (*r.func)(first, std::min(first + r.batch_size, r.count));
+        }
+    }
+};
+constexpr u32 max_range_jobs{ 64 };
+} // namespace detail
+
+// Calls func(u32 first, u32 last) for consecutive ranges of up to batch_size indices covering [0, count) and returns
+// when all of them are done. One job per thread pulls batches from a shared index, so uneven batches balance out
+template<typename Func>
+void parallel_for(u32 count, u32 batch_size, Func&& func)
+{
+    assert(batch_size);
+    if (!count)
+        return;
+
+    const u32 batch_count{ (count + batch_size - 1) / batch_size };
+    if (batch_count == 1)
+    {
+        func(0u, count);
+        return;
+    }
+
+    detail::range_job<std::remove_reference_t<Func>> range{ &func, 0, count, batch_size };
+    counter                                          done{ 0 };
+
+    const u32 job_count{ std::min({ batch_count, thread_count(), detail::max_range_jobs }) };
+    job       range_jobs[detail::max_range_jobs];
+    for (u32 i{ 0 }; i < job_count; ++i)
+    {
+        range_jobs[i] = { &decltype(range)::execute, &range, &done, nullptr };
+    }
+
+    run(&range_jobs[0], job_count);
+    wait(done);
+}
+
+} // namespace lotus::jobs
@@ -104,6 +104,7 @@ constexpr comptr<T> create_com(Args&&... args)
 namespace lotus::graphics::d3d12
 {
 constexpr u32 frame_buffer_count = 3;
+constexpr u64 frame_arena_size   = 1024 * 1024; // starting size of each per frame arena, grows to the high water mark
 
 using id3d12_device                = ID3D12Device10;
 using id3d12_graphics_command_list = ID3D12GraphicsCommandList7;
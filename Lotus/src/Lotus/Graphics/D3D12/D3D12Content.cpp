@@ -49,6 +49,7 @@ struct submesh_view
     D3D12_INDEX_BUFFER_VIEW  index_buffer_view{};
     D3D_PRIMITIVE_TOPOLOGY   primitive_topology{};
     u32                      element_type{};
+    ID3D12Resource*          buffer{};
 };
 
 struct d3d12_render_item
@@ -60,32 +61,27 @@ struct d3d12_render_item
     id::id_type depth_pso_id;
 };
 
-utl::free_list<ID3D12Resource*> submesh_buffers{};
-utl::free_list<submesh_view>    submesh_views{};
-std::mutex                      submesh_mutex{};
+// Read by the render thread every frame while loader threads add and remove content, so these don't take a lock
+utl::concurrent_free_list<submesh_view> submesh_views{};
 
-utl::free_list<d3d12_texture> textures{};
-std::mutex                    texture_mutex{};
+using content_allocator = utl::tracking_allocator<utl::memory_tag::content>;
 
-utl::vector<ID3D12RootSignature*>    root_signatures{};
-std::unordered_map<u64, id::id_type> mtl_rs_map{}; // maps material type and shader flags to index in the root_signatures array
-utl::free_list<scope<u8[]>>          materials{};
-std::mutex                           material_mutex{};
+utl::free_list<d3d12_texture, content_allocator> textures{};
+std::mutex                                       texture_mutex{};
 
-utl::free_list<d3d12_render_item>    render_items{};
-utl::free_list<scope<id::id_type[]>> render_item_ids{};
-std::mutex                           render_item_mutex{};
+// mtl_rs_map maps material type and shader flags to index in the root_signatures array
+utl::vector<ID3D12RootSignature*, true, content_allocator> root_signatures{};
+std::unordered_map<u64, id::id_type>                       mtl_rs_map{};
+utl::free_list<scope<u8[]>, content_allocator>             materials{};
+std::mutex                                                 material_mutex{};
 
-utl::vector<ID3D12PipelineState*>    pipeline_states;
-std::unordered_map<u64, id::id_type> pso_map;
-std::mutex                           pso_mutex{};
+utl::concurrent_free_list<d3d12_render_item>    render_items{};
+utl::concurrent_free_list<scope<id::id_type[]>> render_item_ids{};
 
+utl::concurrent_free_list<ID3D12PipelineState*> pipeline_states;
+std::unordered_map<u64, id::id_type>            pso_map;
+std::mutex                                      pso_mutex{}; // only guards pso_map
 
-struct
-{
-    utl::vector<lotus::content::lod_offset> lod_offsets{};
-    utl::vector<id::id_type>                geometry_ids{};
-} frame_cache;
 
 id::id_type create_root_signature(material_type::type type, shader_flags::flags flags);
 
@@ -329,9 +325,8 @@ id::id_type create_pso_if_needed(const u8* const stream_ptr, u64 aligned_stream_
 
     {
         std::lock_guard lock{ pso_mutex };
-        const auto      id = (u32) pipeline_states.size();
-        pipeline_states.emplace_back(pso);
-        NAME_D3D_OBJ_INDEXED(pipeline_states.back(), key,
+        const u32       id = pipeline_states.add(pso);
+        NAME_D3D_OBJ_INDEXED(pipeline_states[id], key,
                              is_depth ? L"Depth-Only Pipeline State Object - Key" : L"GPass Pipeline State Object - Key");
 
         assert(id::is_valid(id));
@@ -427,12 +422,11 @@ void shutdown()
     mtl_rs_map.clear();
     root_signatures.clear();
 
-    for (auto& item : pipeline_states)
-    {
+    pipeline_states.for_each_live([](u32 id, ID3D12PipelineState*& item) {
         core::release(item);
-    }
+        pipeline_states.remove(id);
+    });
     pso_map.clear();
-    pipeline_states.clear();
 }
 
 namespace submesh
@@ -504,22 +498,15 @@ id::id_type add(const u8*& data)
 
     view.primitive_topology = get_d3d_primitive_topology((primitive_topology::type) primitive_topology);
     view.element_type       = elements_type;
+    view.buffer             = res;
 
-
-    std::lock_guard lock(submesh_mutex);
-
-    submesh_buffers.add(res);
     return submesh_views.add(view);
 }
 
 void remove(id::id_type id)
 {
-    std::lock_guard lock(submesh_mutex);
-
+    core::deferred_release(submesh_views[id].buffer);
     submesh_views.remove(id);
-
-    core::deferred_release(submesh_buffers[id]);
-    submesh_buffers.remove(id);
 }
 
 void get_views(const id::id_type* const gpu_ids, u32 id_count, const views_cache& cache)
@@ -528,8 +515,6 @@ void get_views(const id::id_type* const gpu_ids, u32 id_count, const views_cache
     assert(cache.position_buffers && cache.element_buffers && cache.index_buffer_views && cache.primitive_topologies &&
            cache.elements_types);
 
-    std::lock_guard lock(submesh_mutex);
-
     for (u32 i = 0; i < id_count; ++i)
     {
         const submesh_view& view      = submesh_views[gpu_ids[i]];
@@ -635,8 +620,6 @@ id::id_type add(id::id_type entity_id, id::id_type geometry_content_id, u32 mate
     items[0]                    = geometry_content_id;
     id::id_type* const item_ids = &items[1];
 
-    std::lock_guard lock(render_item_mutex);
-
     for (u32 i = 0; i < material_count; ++i)
     {
         d3d12_render_item item{};
@@ -659,7 +642,6 @@ id::id_type add(id::id_type entity_id, id::id_type geometry_content_id, u32 mate
 
 void remove(id::id_type id)
 {
-    std::lock_guard          lock(render_item_mutex);
     const id::id_type* const item_ids = &render_item_ids[id][1];
 
     for (u32 i = 0; item_ids[i] != id::invalid_id; ++i)
@@ -675,25 +657,22 @@ void get_d3d12_render_item_ids(const frame_info& info, utl::vector<id::id_type>&
     assert(info.render_item_ids && info.thresholds && info.render_item_count);
     assert(d3d12_render_item_ids.empty());
 
-    frame_cache.lod_offsets.clear();
-    frame_cache.geometry_ids.clear();
-    const u32 count = info.render_item_count;
-
-    std::lock_guard lock(render_item_mutex);
+    const u32                         count = info.render_item_count;
+    id::id_type* const                geometry_ids{ core::frame_arena().allocate<id::id_type>(count) };
+    lotus::content::lod_offset* const lod_offsets{ core::frame_arena().allocate<lotus::content::lod_offset>(count) };
 
     for (u32 i = 0; i < count; ++i)
     {
         const id::id_type* const buffer = render_item_ids[info.render_item_ids[i]].get();
-        frame_cache.geometry_ids.emplace_back(buffer[0]);
+        geometry_ids[i]                 = buffer[0];
     }
 
-    lotus::content::get_lod_offsets(frame_cache.geometry_ids.data(), info.thresholds, count, frame_cache.lod_offsets);
-    assert(frame_cache.lod_offsets.size() == count);
+    lotus::content::get_lod_offsets(geometry_ids, info.thresholds, count, lod_offsets);
 
     u32 d3d12_render_item_count = 0;
     for (u32 i = 0; i < count; ++i)
     {
-        d3d12_render_item_count += frame_cache.lod_offsets[i].count;
+        d3d12_render_item_count += lod_offsets[i].count;
     }
 
     assert(d3d12_render_item_count);
@@ -703,7 +682,7 @@ void get_d3d12_render_item_ids(const frame_info& info, utl::vector<id::id_type>&
     for (u32 i = 0; i < count; ++i)
     {
         const id::id_type* const          item_ids = &render_item_ids[info.render_item_ids[i]][1];
-        const lotus::content::lod_offset& lod_offset{ frame_cache.lod_offsets[i] };
+        const lotus::content::lod_offset& lod_offset{ lod_offsets[i] };
         memcpy(&d3d12_render_item_ids[item_idx], &item_ids[lod_offset.offset], id::size * lod_offset.count);
         item_idx += lod_offset.count;
         assert(item_idx <= d3d12_render_item_count);
@@ -717,10 +696,6 @@ void get_items(const id::id_type* const d3d12_render_item_ids, u32 id_count, con
     assert(d3d12_render_item_ids && id_count);
     assert(cache.entity_ids && cache.submesh_gpu_ids && cache.material_ids && cache.psos && cache.depth_psos);
 
-
-    std::lock_guard lock1(render_item_mutex);
-    std::lock_guard lock2(pso_mutex);
-
     for (u32 i = 0; i < id_count; ++i)
     {
         const auto& [entity_id, submesh_gpu_id, material_id, pso_id, depth_pso_id] = render_items[d3d12_render_item_ids[i]];
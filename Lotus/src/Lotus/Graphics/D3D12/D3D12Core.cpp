@@ -217,6 +217,7 @@ d3d12_command                gfx_command;
 surface_collection           surfaces;
 d3dx::d3d12_resource_barrier resource_barriers{};
 constant_buffer              constant_buffers[frame_buffer_count];
+utl::linear_arena            frame_arenas[frame_buffer_count];
 
 descriptor_heap rtv_desc_heap(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);         // render targets
 descriptor_heap dsv_desc_heap(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);         // depth stencils
@@ -430,6 +431,7 @@ bool initialize()
     {
         new (&constant_buffers[i]) constant_buffer{ constant_buffer::get_default_init_info(1_MBu) };
         NAME_D3D_OBJ_INDEXED(constant_buffers[i].buffer(), i, L"Global Constant Buffer");
+        frame_arenas[i].reserve(frame_arena_size);
     }
 
     new (&gfx_command) d3d12_command(main_device, D3D12_COMMAND_LIST_TYPE_DIRECT);
@@ -473,6 +475,11 @@ void shutdown()
     for (u32 i{ 0 }; i < frame_buffer_count; ++i)
     {
         constant_buffers[i].release();
+
+        const utl::linear_arena::statistics stats{ frame_arenas[i].stats() };
+        LOG_INFO("Frame arena {}: high water mark {} of {} bytes, grown {} times", i, stats.high_water_mark, stats.capacity,
+                 stats.grow_count);
+        frame_arenas[i].release();
     }
 
     rtv_desc_heap.process_deferred_free(0);
@@ -548,6 +555,11 @@ constant_buffer& cbuffer()
     return constant_buffers[current_frame_index()];
 }
 
+utl::linear_arena& frame_arena()
+{
+    return frame_arenas[current_frame_index()];
+}
+
 
 surface create_surface(platform::window window)
 {
@@ -588,6 +600,7 @@ void render_surface(surface_id id, frame_info info)
     // Clear the global constant buffer for the current frame
     constant_buffer& cbuffer{ constant_buffers[frame_index] };
     cbuffer.clear();
+    frame_arenas[frame_index].reset();
 
     if (deferred_releases_flag[frame_index])
     {
@@ -599,7 +612,7 @@ void render_surface(surface_id id, frame_info info)
     ID3D12Resource* const current_back_buffer = surface.back_buffer();
 
 
-    const d3d12_frame_info d3d12_info{ get_d3d12_frame_info(info, cbuffer, surface, frame_index, 16.7f) };
+    const d3d12_frame_info d3d12_info{ get_d3d12_frame_info(info, cbuffer, surface, frame_index, info.last_frame_time) };
 
     gpass::set_size({ d3d12_info.surface_width, d3d12_info.surface_height });
     d3dx::d3d12_resource_barrier& barriers{ resource_barriers };
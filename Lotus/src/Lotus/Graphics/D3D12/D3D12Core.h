@@ -86,6 +86,10 @@ void set_derferred_releases_flag();
 [[nodiscard]] descriptor_heap& uav_heap();
 [[nodiscard]] constant_buffer& cbuffer();
 
+// Cpu memory for data that only lives for the current frame, reset at the start of render_surface
+// Only for the render thread, since the reset doesn't wait for other threads to be done with it
+[[nodiscard]] utl::linear_arena& frame_arena();
+
 
 [[nodiscard]] surface create_surface(platform::window window);
 void                  remove_surface(surface_id id);
@@ -93,32 +93,25 @@ struct gpass_cache
 
     CONSTEXPR void clear() { d3d12_render_item_ids.clear(); }
 
-    CONSTEXPR void resize()
+    // Per frame arrays, so they come from the frame arena and never need regrowing
+    void resize()
     {
         const u64 items_count{ d3d12_render_item_ids.size() };
-        const u64 new_buffer_size{ items_count * struct_size };
-        const u64 old_buffer_size{ m_buffer.size() };
-        if (new_buffer_size > old_buffer_size)
-        {
-            m_buffer.resize(new_buffer_size);
-        }
-
-        if (new_buffer_size != old_buffer_size)
-        {
-            entity_ids            = (id::id_type*) m_buffer.data();
-            submesh_gpu_ids       = (id::id_type*) &entity_ids[items_count];
-            material_ids          = (id::id_type*) &submesh_gpu_ids[items_count];
-            gpass_pipeline_states = (ID3D12PipelineState**) &material_ids[items_count];
-            depth_pipeline_states = (ID3D12PipelineState**) &gpass_pipeline_states[items_count];
-            root_signatures       = (ID3D12RootSignature**) &depth_pipeline_states[items_count];
-            material_types        = (material_type::type*) &root_signatures[items_count];
-            position_buffers      = (D3D12_GPU_VIRTUAL_ADDRESS*) &material_types[items_count];
-            element_buffers       = (D3D12_GPU_VIRTUAL_ADDRESS*) &position_buffers[items_count];
-            index_buffer_views    = (D3D12_INDEX_BUFFER_VIEW*) &element_buffers[items_count];
-            primitive_topologies  = (D3D_PRIMITIVE_TOPOLOGY*) &index_buffer_views[items_count];
-            elements_types        = (u32*) &primitive_topologies[items_count];
-            per_object_data       = (D3D12_GPU_VIRTUAL_ADDRESS*) &elements_types[items_count];
-        }
+        u8* const buffer{ (u8*) core::frame_arena().allocate(items_count * struct_size) };
+
+        entity_ids            = (id::id_type*) buffer;
+        submesh_gpu_ids       = (id::id_type*) &entity_ids[items_count];
+        material_ids          = (id::id_type*) &submesh_gpu_ids[items_count];
+        gpass_pipeline_states = (ID3D12PipelineState**) &material_ids[items_count];
+        depth_pipeline_states = (ID3D12PipelineState**) &gpass_pipeline_states[items_count];
+        root_signatures       = (ID3D12RootSignature**) &depth_pipeline_states[items_count];
+        material_types        = (material_type::type*) &root_signatures[items_count];
+        position_buffers      = (D3D12_GPU_VIRTUAL_ADDRESS*) &material_types[items_count];
+        element_buffers       = (D3D12_GPU_VIRTUAL_ADDRESS*) &position_buffers[items_count];
+        index_buffer_views    = (D3D12_INDEX_BUFFER_VIEW*) &element_buffers[items_count];
+        primitive_topologies  = (D3D_PRIMITIVE_TOPOLOGY*) &index_buffer_views[items_count];
+        elements_types        = (u32*) &primitive_topologies[items_count];
+        per_object_data       = (D3D12_GPU_VIRTUAL_ADDRESS*) &elements_types[items_count];
     }
 
 private:
@@ -138,8 +131,6 @@ struct gpass_cache
         sizeof(D3D12_GPU_VIRTUAL_ADDRESS)   // per_object_data
 
     };
-
-    utl::vector<u8> m_buffer;
 } frame_cache;
 
 #undef CONSTEXPR
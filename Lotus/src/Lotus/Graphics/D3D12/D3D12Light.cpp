@@ -236,9 +236,11 @@ class light_set
     constexpr bool has_lights() const { return m_owners.size() > 0; }
 
 private:
-    utl::free_list<light_owner>                   m_owners;
-    utl::vector<light_id>                         m_non_cullable_owners;
-    utl::vector<hlsl::DirectionalLightParameters> m_non_cullable_lights;
+    using light_allocator = utl::tracking_allocator<utl::memory_tag::lights>;
+
+    utl::free_list<light_owner, light_allocator>                         m_owners;
+    utl::vector<light_id, true, light_allocator>                         m_non_cullable_owners;
+    utl::vector<hlsl::DirectionalLightParameters, true, light_allocator> m_non_cullable_lights;
 };
 
 class d3d12_light_buffer
@@ -0,0 +1,134 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: NullCommon.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "../../Common.h"
+#include "../../Graphics/Renderer.h"
+#include "../../Platform/Window.h"
+
+#include <chrono>
+
+// The null platform is a headless stand-in for the d3d12 renderer. It owns no gpu objects, but it runs the same cpu side
+// frame preparation as d3d12::core::render_surface so frame prep can be profiled on machines without a gpu.
+// It doesn't make the engine portable. The engine still needs DirectXMath and Win32 and only builds with MSVC, so the
+// null platform runs on Windows machines without a gpu, not on Linux
+
+namespace lotus::graphics::null
+{
+constexpr u32 frame_buffer_count = 3;
+constexpr u64 frame_arena_size   = 1024 * 1024; // starting size of each per frame arena, grows to the high water mark
+
+// Same values as D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT and D3D12_STANDARD_MAXIMUM_ELEMENT_ALIGNMENT_BYTE_MULTIPLE
+// so the cpu side buffers are packed identically to the d3d12 ones
+constexpr u32 constant_buffer_alignment = 256;
+constexpr u32 element_alignment         = 4;
+
+// Stand-in for a gpu virtual address, an offset into a cpu side buffer
+using null_gpu_address = u64;
+
+// Stand-in for d3d12's constant_buffer. Allocations are linear and cleared at the start of every frame
+class null_constant_buffer
+{
+public:
+    null_constant_buffer() = default;
+    explicit null_constant_buffer(u32 size) : m_buffer(size) {}
+    DISABLE_COPY_AND_MOVE(null_constant_buffer);
+
+    void release()
+    {
+        m_buffer.clear();
+        m_cpu_offset = 0;
+    }
+
+    constexpr void clear() { m_cpu_offset = 0; }
+
+    [[nodiscard]] u8* allocate(u32 size)
+    {
+        std::lock_guard lock{ m_mutex };
+
+        const u32 aligned_size{ (u32) math::align_size_up<constant_buffer_alignment>(size) };
+        assert(m_cpu_offset + aligned_size <= m_buffer.size());
+        if (m_cpu_offset + aligned_size <= m_buffer.size())
+        {
+            u8* const address{ m_buffer.data() + m_cpu_offset };
+            m_cpu_offset += aligned_size;
+            return address;
+        }
+
+        return nullptr;
+    }
+
+    template<typename T>
+    [[nodiscard]] T* allocate()
+    {
+        return (T* const) allocate(sizeof(T));
+    }
+
+    template<typename T>
+    [[nodiscard]] null_gpu_address gpu_address(T* const allocation) const
+    {
+        const auto address{ (const u8* const) allocation };
+        assert(address >= m_buffer.data() && address <= m_buffer.data() + m_cpu_offset);
+        return (null_gpu_address) (address - m_buffer.data());
+    }
+
+    [[nodiscard]] u32 size() const { return (u32) m_buffer.size(); }
+    [[nodiscard]] u32 used() const { return m_cpu_offset; }
+
+private:
+    utl::vector<u8> m_buffer{};
+    u32             m_cpu_offset{};
+    std::mutex      m_mutex{};
+};
+
+class timer
+{
+public:
+    using clock = std::chrono::high_resolution_clock;
+
+    void begin() { m_start = clock::now(); }
+
+    // Returns the elapsed time in milliseconds since begin()
+    [[nodiscard]] f32 end() const
+    {
+        return std::chrono::duration<f32, std::milli>(clock::now() - m_start).count();
+    }
+
+private:
+    clock::time_point m_start{};
+};
+
+} // namespace lotus::graphics::null
+
+namespace lotus::graphics::null::hlsl
+{
+using uint     = u32;
+using uint2    = vec2u;
+using uint3    = vec3u;
+using float4   = vec4;
+using float3   = vec3;
+using float2   = vec2;
+using float4x4 = mat4a;
+#include "../D3D12/Shaders/CommonTypes.hlsli"
+} // namespace lotus::graphics::null::hlsl
@@ -0,0 +1,407 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: NullContent.cpp
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+
+#include "NullContent.h"
+
+#include "NullCore.h"
+#include "Util/IOStream.h"
+#include "Content/ContentToEngine.h"
+
+
+namespace lotus::graphics::null::content
+{
+
+namespace
+{
+
+struct pso_id
+{
+    id::id_type gpass = id::invalid_id;
+    id::id_type depth = id::invalid_id;
+};
+
+// Cpu side stand-in for the d3d12 submesh buffer. Only what is needed to produce the same views is kept
+struct submesh_view
+{
+    null_gpu_address         position_buffer{};
+    null_gpu_address         element_buffer{};
+    u32                      index_count{};
+    primitive_topology::type primitive_topology{};
+    u32                      element_type{};
+};
+
+struct null_material
+{
+    material_type::type type{};
+    shader_flags::flags shader_flags{};
+    id::id_type         root_signature_id{ id::invalid_id };
+    u32                 texture_count{};
+};
+
+struct null_render_item
+{
+    id::id_type entity_id;
+    id::id_type submesh_gpu_id;
+    id::id_type material_id;
+    id::id_type pso_id;
+    id::id_type depth_pso_id;
+};
+
+utl::free_list<submesh_view> submesh_views{};
+std::mutex                   submesh_mutex{};
+
+using content_allocator = utl::tracking_allocator<utl::memory_tag::content>;
+
+// mtl_rs_map maps material type and shader flags to index in the root_signatures array
+utl::vector<u64, true, content_allocator>        root_signatures{};
+std::unordered_map<u64, id::id_type>             mtl_rs_map{};
+utl::free_list<null_material, content_allocator> materials{};
+std::mutex                                       material_mutex{};
+
+utl::free_list<null_render_item>     render_items{};
+utl::free_list<scope<id::id_type[]>> render_item_ids{};
+std::mutex                           render_item_mutex{};
+
+utl::vector<u64>                     pipeline_states;
+std::unordered_map<u64, id::id_type> pso_map;
+std::mutex                           pso_mutex{};
+
+// Running total of all submesh buffer sizes, used to hand out fake gpu addresses
+null_gpu_address next_buffer_address{ 0 };
+
+id::id_type create_root_signature(material_type::type type, shader_flags::flags flags)
+{
+    assert(type < material_type::count);
+    static_assert(sizeof(type) == sizeof(u32) && sizeof(flags) == sizeof(u32));
+
+    const u64 key = ((u64) type << 32) | flags;
+    if (const auto pair = mtl_rs_map.find(key); pair != mtl_rs_map.end())
+    {
+        assert(pair->first == key);
+        return pair->second;
+    }
+
+    const auto id = (id::id_type) root_signatures.size();
+    root_signatures.emplace_back(key);
+    mtl_rs_map[key] = id;
+
+    return id;
+}
+
+// The d3d12 platform keys its pipeline states on a crc of the subobject stream. Here the key is built from the state that
+// would have gone into that stream
+id::id_type create_pso_if_needed(u64 key)
+{
+    std::lock_guard lock{ pso_mutex };
+    if (const auto pair = pso_map.find(key); pair != pso_map.end())
+    {
+        assert(pair->first == key);
+        return pair->second;
+    }
+
+    const auto id = (id::id_type) pipeline_states.size();
+    pipeline_states.emplace_back(key);
+    pso_map[key] = id;
+    return id;
+}
+
+pso_id create_pso(id::id_type material_id, primitive_topology::type topology, u32 elements_type)
+{
+    u64 key{};
+    {
+        std::lock_guard      lock(material_mutex);
+        const null_material& material{ materials[material_id] };
+        key = ((u64) material.root_signature_id << 32) | ((u64) topology << 24) | ((u64) elements_type << 1);
+    }
+
+    pso_id pair{};
+    pair.gpass = create_pso_if_needed(key);
+    pair.depth = create_pso_if_needed(key | 1);
+
+    return pair;
+}
+
+} // anonymous namespace
+
+bool initialize()
+{
+    return true;
+}
+
+void shutdown()
+{
+    mtl_rs_map.clear();
+    root_signatures.clear();
+
+    pso_map.clear();
+    pipeline_states.clear();
+
+    next_buffer_address = 0;
+}
+
+namespace submesh
+{
+
+// Same data format as d3d12::content::submesh::add. This will advance the data pointer
+id::id_type add(const u8*& data)
+{
+    utl::blob_stream_reader blob{ data };
+
+    const u32 element_size       = blob.read<u32>();
+    const u32 vertex_count       = blob.read<u32>();
+    const u32 index_count        = blob.read<u32>();
+    const u32 elements_type      = blob.read<u32>();
+    const u32 primitive_topology = blob.read<u32>();
+    const u32 index_size         = vertex_count < (1 << 16) ? sizeof(u16) : sizeof(u32);
+
+    const u32 pos_buffer_size   = sizeof(vec3) * vertex_count;
+    const u32 elem_buffer_size  = element_size * vertex_count;
+    const u32 index_buffer_size = index_size * index_count;
+
+    const u32 aligned_pos_buffer_size  = (u32) math::align_size_up<element_alignment>(pos_buffer_size);
+    const u32 aligned_elem_buffer_size = (u32) math::align_size_up<element_alignment>(elem_buffer_size);
+
+    const u32 total_buffer_size = aligned_pos_buffer_size + aligned_elem_buffer_size + index_buffer_size;
+
+    blob.skip(total_buffer_size);
+    data = blob.position();
+
+    std::lock_guard lock(submesh_mutex);
+
+    submesh_view view{};
+    view.position_buffer    = next_buffer_address;
+    view.element_buffer     = element_size ? next_buffer_address + aligned_pos_buffer_size : 0;
+    view.index_count        = index_count;
+    view.primitive_topology = (primitive_topology::type) primitive_topology;
+    view.element_type       = elements_type;
+
+    next_buffer_address += math::align_size_up<constant_buffer_alignment>(total_buffer_size);
+
+    return submesh_views.add(view);
+}
+
+void remove(id::id_type id)
+{
+    std::lock_guard lock(submesh_mutex);
+    submesh_views.remove(id);
+}
+
+void get_views(const id::id_type* const gpu_ids, u32 id_count, const views_cache& cache)
+{
+    assert(gpu_ids && id_count);
+    assert(cache.position_buffers && cache.element_buffers && cache.index_counts && cache.primitive_topologies &&
+           cache.elements_types);
+
+    std::lock_guard lock(submesh_mutex);
+
+    for (u32 i = 0; i < id_count; ++i)
+    {
+        const submesh_view& view      = submesh_views[gpu_ids[i]];
+        cache.position_buffers[i]     = view.position_buffer;
+        cache.element_buffers[i]      = view.element_buffer;
+        cache.index_counts[i]         = view.index_count;
+        cache.primitive_topologies[i] = view.primitive_topology;
+        cache.elements_types[i]       = view.element_type;
+    }
+}
+
+} // namespace submesh
+
+
+namespace material
+{
+
+id::id_type add(material_init_info info)
+{
+    u32 flags = 0;
+    for (u32 i = 0; i < shader_type::count; ++i)
+    {
+        if (id::is_valid(info.shader_ids[i]))
+        {
+            flags |= (1 << i);
+        }
+    }
+
+    assert(flags);
+
+    null_material material{};
+    material.type          = info.type;
+    material.shader_flags  = (shader_flags::flags) flags;
+    material.texture_count = info.texture_count;
+
+    std::lock_guard lock(material_mutex);
+    material.root_signature_id = create_root_signature(info.type, material.shader_flags);
+    return materials.add(material);
+}
+
+void remove(id::id_type id)
+{
+    std::lock_guard lock(material_mutex);
+    materials.remove(id);
+}
+
+void get_materials(const id::id_type* const material_ids, u32 material_count, const materials_cache& cache)
+{
+    assert(material_ids && material_count);
+    assert(cache.root_signature_ids && cache.material_types);
+    std::lock_guard lock(material_mutex);
+
+    for (u32 i = 0; i < material_count; ++i)
+    {
+        const null_material& material{ materials[material_ids[i]] };
+        cache.root_signature_ids[i] = material.root_signature_id;
+        cache.material_types[i]     = material.type;
+    }
+}
+
+} // namespace material
+
+
+namespace render_item
+{
+
+// Same format as d3d12::content::render_item::add
+// buffer[0] = geometry_content_id
+// buffer[1 .. n] = null_render_item_ids -> n = number of low level render item ids which must == the number of submeshes/material ids
+// buffer[n+1] = id::invalid_id
+id::id_type add(id::id_type entity_id, id::id_type geometry_content_id, u32 material_count, const id::id_type* const material_ids)
+{
+    assert(id::is_valid(entity_id) && id::is_valid(geometry_content_id));
+    assert(material_count && material_ids);
+    const auto gpu_ids = (id::id_type* const) alloca(material_count * id::size);
+    lotus::content::get_submesh_gpu_ids(geometry_content_id, material_count, gpu_ids);
+
+    const submesh::views_cache views_cache{
+        (null_gpu_address* const) alloca(material_count * sizeof(null_gpu_address)),
+        (null_gpu_address* const) alloca(material_count * sizeof(null_gpu_address)),
+        (u32* const) alloca(material_count * sizeof(u32)),
+        (primitive_topology::type* const) alloca(material_count * sizeof(primitive_topology::type)),
+        (u32* const) alloca(material_count * sizeof(u32)),
+    };
+
+    submesh::get_views(gpu_ids, material_count, views_cache);
+
+    scope<id::id_type[]> items = create_scope<id::id_type[]>(id::size * (1 + (u64) material_count + 1));
+
+    items[0]                    = geometry_content_id;
+    id::id_type* const item_ids = &items[1];
+
+    std::lock_guard lock(render_item_mutex);
+
+    for (u32 i = 0; i < material_count; ++i)
+    {
+        null_render_item item{};
+        item.entity_id      = entity_id;
+        item.submesh_gpu_id = gpu_ids[i];
+        item.material_id    = material_ids[i];
+        auto [gpass, depth] = create_pso(item.material_id, views_cache.primitive_topologies[i], views_cache.elements_types[i]);
+        item.pso_id         = gpass;
+        item.depth_pso_id   = depth;
+
+        assert(id::is_valid(item.submesh_gpu_id) && id::is_valid(item.material_id));
+        item_ids[i] = render_items.add(item);
+    }
+
+    // Mark end of ids list
+    item_ids[material_count] = id::invalid_id;
+
+    return render_item_ids.add(std::move(items));
+}
+
+void remove(id::id_type id)
+{
+    std::lock_guard          lock(render_item_mutex);
+    const id::id_type* const item_ids = &render_item_ids[id][1];
+
+    for (u32 i = 0; item_ids[i] != id::invalid_id; ++i)
+    {
+        render_items.remove(item_ids[i]);
+    }
+
+    render_item_ids.remove(id);
+}
+
+void get_null_render_item_ids(const frame_info& info, utl::vector<id::id_type>& null_render_item_ids)
+{
+    assert(info.render_item_ids && info.thresholds && info.render_item_count);
+    assert(null_render_item_ids.empty());
+
+    const u32                         count = info.render_item_count;
+    id::id_type* const                geometry_ids{ core::frame_arena().allocate<id::id_type>(count) };
+    lotus::content::lod_offset* const lod_offsets{ core::frame_arena().allocate<lotus::content::lod_offset>(count) };
+
+    std::lock_guard lock(render_item_mutex);
+
+    for (u32 i = 0; i < count; ++i)
+    {
+        const id::id_type* const buffer = render_item_ids[info.render_item_ids[i]].get();
+        geometry_ids[i]                 = buffer[0];
+    }
+
+    lotus::content::get_lod_offsets(geometry_ids, info.thresholds, count, lod_offsets);
+
+    u32 null_render_item_count = 0;
+    for (u32 i = 0; i < count; ++i)
+    {
+        null_render_item_count += lod_offsets[i].count;
+    }
+
+    assert(null_render_item_count);
+    null_render_item_ids.resize(null_render_item_count);
+
+    u32 item_idx = 0;
+    for (u32 i = 0; i < count; ++i)
+    {
+        const id::id_type* const          item_ids = &render_item_ids[info.render_item_ids[i]][1];
+        const lotus::content::lod_offset& lod_offset{ lod_offsets[i] };
+        memcpy(&null_render_item_ids[item_idx], &item_ids[lod_offset.offset], id::size * lod_offset.count);
+        item_idx += lod_offset.count;
+        assert(item_idx <= null_render_item_count);
+    }
+
+    assert(item_idx <= null_render_item_count);
+}
+
+void get_items(const id::id_type* const null_render_item_ids, u32 id_count, const items_cache& cache)
+{
+    assert(null_render_item_ids && id_count);
+    assert(cache.entity_ids && cache.submesh_gpu_ids && cache.material_ids && cache.psos && cache.depth_psos);
+
+    std::lock_guard lock(render_item_mutex);
+
+    for (u32 i = 0; i < id_count; ++i)
+    {
+        const auto& [entity_id, submesh_gpu_id, material_id, pso_id, depth_pso_id] = render_items[null_render_item_ids[i]];
+
+        cache.entity_ids[i]      = entity_id;
+        cache.submesh_gpu_ids[i] = submesh_gpu_id;
+        cache.material_ids[i]    = material_id;
+        cache.psos[i]            = pso_id;
+        cache.depth_psos[i]      = depth_pso_id;
+    }
+}
+
+} // namespace render_item
+
+
+} // namespace lotus::graphics::null::content
@@ -0,0 +1,86 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: NullContent.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "NullCommon.h"
+
+namespace lotus::graphics::null::content
+{
+
+bool initialize();
+void shutdown();
+
+namespace submesh
+{
+
+struct views_cache
+{
+    null_gpu_address* const         position_buffers;
+    null_gpu_address* const         element_buffers;
+    u32* const                      index_counts;
+    primitive_topology::type* const primitive_topologies;
+    u32* const                      elements_types;
+};
+
+id::id_type add(const u8*& data);
+void        remove(id::id_type id);
+void        get_views(const id::id_type* const gpu_ids, u32 id_count, const views_cache& cache);
+} // namespace submesh
+
+namespace material
+{
+
+struct materials_cache
+{
+    id::id_type* const         root_signature_ids;
+    material_type::type* const material_types;
+};
+
+id::id_type add(material_init_info info);
+void        remove(id::id_type id);
+void        get_materials(const id::id_type* const material_ids, u32 material_count, const materials_cache& cache);
+} // namespace material
+
+
+namespace render_item
+{
+
+struct items_cache
+{
+    id::id_type* const entity_ids;
+    id::id_type* const submesh_gpu_ids;
+    id::id_type* const material_ids;
+    id::id_type* const psos;
+    id::id_type* const depth_psos;
+};
+
+id::id_type add(id::id_type entity_id, id::id_type geometry_content_id, u32 material_count,
+                const id::id_type* const material_ids);
+void        remove(id::id_type id);
+void        get_null_render_item_ids(const frame_info& info, utl::vector<id::id_type>& null_render_item_ids);
+void        get_items(const id::id_type* const null_render_item_ids, u32 id_count, const items_cache& cache);
+
+} // namespace render_item
+
+} // namespace lotus::graphics::null::content
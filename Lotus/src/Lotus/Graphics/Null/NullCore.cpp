@@ -0,0 +1,249 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: NullCore.cpp
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+
+#include "NullCore.h"
+
+#include "NullCamera.h"
+#include "NullContent.h"
+#include "NullGPass.h"
+#include "NullLight.h"
+#include "Util/Logger.h"
+
+namespace lotus::graphics::null::core
+{
+
+namespace
+{
+
+constexpr u32 default_surface_width{ 1920 };
+constexpr u32 default_surface_height{ 1080 };
+
+class null_surface
+{
+public:
+    explicit null_surface(platform::window window) : m_window{ window }
+    {
+        if (m_window.is_valid())
+        {
+            m_width  = m_window.width();
+            m_height = m_window.height();
+        }
+    }
+
+    constexpr void resize(u32 width, u32 height)
+    {
+        m_width  = width;
+        m_height = height;
+    }
+
+    [[nodiscard]] constexpr u32 width() const { return m_width; }
+    [[nodiscard]] constexpr u32 height() const { return m_height; }
+
+private:
+    platform::window m_window{};
+    u32              m_width{ default_surface_width };
+    u32              m_height{ default_surface_height };
+};
+
+using surface_collection = utl::free_list<null_surface>;
+
+surface_collection   surfaces;
+null_constant_buffer constant_buffers[frame_buffer_count];
+utl::linear_arena    frame_arenas[frame_buffer_count];
+u32                  frame_index{ 0 };
+frame_timings        timings{};
+
+bool failed_init()
+{
+    shutdown();
+    return false;
+}
+
+null_frame_info get_null_frame_info(const frame_info& info, null_constant_buffer& cbuffer, const null_surface& surface,
+                                    u32 frame_index, f32 delta_time)
+{
+    camera::null_camera& camera{ camera::get(info.cam_id) };
+    camera.update();
+    hlsl::GlobalShaderData data{};
+
+    math::store_float4x4a(&data.View, camera.view());
+    math::store_float4x4a(&data.Projection, camera.projection());
+    math::store_float4x4a(&data.InvProjection, camera.inverse_projection());
+    math::store_float4x4a(&data.ViewProjection, camera.view_projection());
+    math::store_float4x4a(&data.InvViewProjection, camera.inverse_view_projection());
+    math::store_float3(&data.CameraPosition, camera.position());
+    math::store_float3(&data.CameraDirection, camera.direction());
+    data.ViewWidth            = (f32) surface.width();
+    data.ViewHeight           = (f32) surface.height();
+    data.NumDirectionalLights = light::non_cullable_light_count(info.light_set_key);
+    data.DeltaTime            = delta_time;
+
+    hlsl::GlobalShaderData* const shader_data{ cbuffer.allocate<hlsl::GlobalShaderData>() };
+    memcpy(shader_data, &data, sizeof(hlsl::GlobalShaderData));
+
+    const null_frame_info null_info{ &info,           &camera,          cbuffer.gpu_address(shader_data),
+                                     surface.width(), surface.height(), frame_index,
+                                     delta_time };
+
+    return null_info;
+}
+
+} // anonymous namespace
+
+bool initialize()
+{
+    for (u32 i{ 0 }; i < frame_buffer_count; ++i)
+    {
+        new (&constant_buffers[i]) null_constant_buffer{ 1_MBu };
+        frame_arenas[i].reserve(frame_arena_size);
+    }
+
+    if (!(gpass::initialize() && content::initialize() && light::initialize()))
+        return failed_init();
+
+    LOG_INFO("Null renderer initialized");
+    return true;
+}
+
+void shutdown()
+{
+    light::shutdown();
+    content::shutdown();
+    gpass::shutdown();
+
+    for (u32 i{ 0 }; i < frame_buffer_count; ++i)
+    {
+        constant_buffers[i].release();
+        frame_arenas[i].release();
+    }
+
+    frame_index = 0;
+    timings     = {};
+}
+
+u32 current_frame_index()
+{
+    return frame_index;
+}
+
+null_constant_buffer& cbuffer()
+{
+    return constant_buffers[current_frame_index()];
+}
+
+utl::linear_arena& frame_arena()
+{
+    return frame_arenas[current_frame_index()];
+}
+
+surface create_surface(platform::window window)
+{
+    const surface_id id{ surfaces.add(window) };
+    return surface{ id };
+}
+
+void remove_surface(surface_id id)
+{
+    surfaces.remove(id);
+}
+
+void resize_surface(surface_id id, u32 width, u32 height)
+{
+    surfaces[id].resize(width, height);
+}
+
+u32 surface_width(surface_id id)
+{
+    return surfaces[id].width();
+}
+
+u32 surface_height(surface_id id)
+{
+    return surfaces[id].height();
+}
+
+// Runs the same cpu side work as d3d12::core::render_surface, in the same order, timing every stage
+void render_surface(surface_id id, frame_info info)
+{
+    timer frame_timer{};
+    timer stage_timer{};
+    frame_timer.begin();
+
+    // Clear the global constant buffer for the current frame
+    null_constant_buffer& cbuffer{ constant_buffers[frame_index] };
+    cbuffer.clear();
+    frame_arenas[frame_index].reset();
+
+    const null_surface& surface{ surfaces[id] };
+
+    frame_timings     t{};
+    gpass::draw_stats stats{};
+
+    stage_timer.begin();
+    const null_frame_info null_info{ get_null_frame_info(info, cbuffer, surface, frame_index, info.last_frame_time) };
+    gpass::set_size({ null_info.surface_width, null_info.surface_height });
+    t.frame_setup = stage_timer.end();
+
+    // Depth prepass
+    stage_timer.begin();
+    gpass::resolve_render_items(null_info);
+    t.render_item_resolution = stage_timer.end();
+
+    stage_timer.begin();
+    gpass::fetch_render_items();
+    t.render_item_fetch = stage_timer.end();
+
+    stage_timer.begin();
+    gpass::fill_per_object_data(null_info);
+    t.per_object_data = stage_timer.end();
+
+    stage_timer.begin();
+    gpass::depth_prepass(null_info, stats);
+    t.draw_submission = stage_timer.end();
+
+    // Geometry and lighting pass
+    stage_timer.begin();
+    light::update_light_buffers(null_info);
+    t.light_packing = stage_timer.end();
+
+    stage_timer.begin();
+    gpass::render(null_info, stats);
+    t.draw_submission += stage_timer.end();
+
+    t.render_item_count = gpass::render_item_count();
+    t.draw_count        = stats.draw_count;
+    t.state_changes     = stats.state_changes;
+    t.bind_count        = stats.bind_count;
+    t.bound_addresses   = stats.bound_addresses;
+    t.total             = frame_timer.end();
+    timings             = t;
+
+    frame_index = (frame_index + 1) % frame_buffer_count;
+}
+
+const frame_timings& last_frame_timings()
+{
+    return timings;
+}
+
+} // namespace lotus::graphics::null::core
@@ -0,0 +1,89 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: NullCore.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "NullCommon.h"
+
+namespace lotus::graphics::null
+{
+
+namespace camera
+{
+class null_camera;
+}
+
+struct null_frame_info
+{
+    const frame_info*    info{};
+    camera::null_camera* camera{};
+    null_gpu_address     global_shader_data{};
+    u32                  surface_width{};
+    u32                  surface_height{};
+    u32                  frame_index{};
+    f32                  delta_time{};
+};
+
+// Cpu time in milliseconds spent in each stage of the last call to render_surface
+struct frame_timings
+{
+    f32 frame_setup{};            // camera update and global shader data
+    f32 render_item_resolution{}; // render item ids to low level item ids, including lod selection
+    f32 render_item_fetch{};      // items, submesh views and materials
+    f32 per_object_data{};        // world, inverse world and world view projection fill
+    f32 light_packing{};          // light transforms and light buffer packing
+    f32 draw_submission{};        // state change and draw call recording
+    f32 total{};
+
+    u32 render_item_count{};
+    u32 draw_count{};
+    u32 state_changes{};
+    u32 bind_count{};
+    u64 bound_addresses{}; // every address bound this frame xor'ed together, a checksum of what was bound
+};
+
+} // namespace lotus::graphics::null
+
+namespace lotus::graphics::null::core
+{
+bool initialize();
+void shutdown();
+
+u32 current_frame_index();
+
+[[nodiscard]] null_constant_buffer& cbuffer();
+
+// Cpu memory for data that only lives for the current frame, reset at the start of render_surface
+// Only for the render thread, since the reset doesn't wait for other threads to be done with it
+[[nodiscard]] utl::linear_arena& frame_arena();
+
+[[nodiscard]] surface create_surface(platform::window window);
+void                  remove_surface(surface_id id);
+void                  resize_surface(surface_id id, u32 width, u32 height);
+[[nodiscard]] u32     surface_width(surface_id id);
+[[nodiscard]] u32     surface_height(surface_id id);
+void                  render_surface(surface_id id, frame_info info);
+
+[[nodiscard]] const frame_timings& last_frame_timings();
+
+} // namespace lotus::graphics::null::core
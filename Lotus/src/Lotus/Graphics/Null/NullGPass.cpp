@@ -0,0 +1,314 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: NullGPass.cpp
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+
+#include "NullGPass.h"
+#include "NullCore.h"
+#include "NullCamera.h"
+#include "NullContent.h"
+#include "NullLight.h"
+#include "Components/Transform.h"
+
+namespace lotus::graphics::null::gpass
+{
+
+namespace
+{
+
+constexpr vec2u initial_dimensions{ 100, 100 };
+
+vec2u dimensions{ initial_dimensions };
+
+#if USE_STL_VECTOR
+    #define CONSTEXPR
+#else
+    #define CONSTEXPR constexpr
+#endif
+
+struct gpass_cache
+{
+    utl::vector<id::id_type>  null_render_item_ids;
+    id::id_type*              entity_ids{ nullptr };
+    id::id_type*              submesh_gpu_ids{ nullptr };
+    id::id_type*              material_ids{ nullptr };
+    id::id_type*              gpass_pipeline_states{ nullptr };
+    id::id_type*              depth_pipeline_states{ nullptr };
+    id::id_type*              root_signatures{ nullptr };
+    material_type::type*      material_types{ nullptr };
+    null_gpu_address*         position_buffers{ nullptr };
+    null_gpu_address*         element_buffers{ nullptr };
+    u32*                      index_counts{ nullptr };
+    primitive_topology::type* primitive_topologies{ nullptr };
+    u32*                      elements_types{ nullptr };
+    null_gpu_address*         per_object_data{ nullptr };
+
+    [[nodiscard]] constexpr content::render_item::items_cache items_cache() const
+    {
+        return { entity_ids, submesh_gpu_ids, material_ids, gpass_pipeline_states, depth_pipeline_states };
+    }
+
+    [[nodiscard]] constexpr content::submesh::views_cache views_cache() const
+    {
+        return { position_buffers, element_buffers, index_counts, primitive_topologies, elements_types };
+    }
+
+    [[nodiscard]] constexpr content::material::materials_cache materials_cache() const
+    {
+        return { root_signatures, material_types };
+    }
+
+    [[nodiscard]] CONSTEXPR u32 size() const { return (u32) null_render_item_ids.size(); }
+
+    CONSTEXPR void clear() { null_render_item_ids.clear(); }
+
+    // Per frame arrays, so they come from the frame arena and never need regrowing
+    void resize()
+    {
+        const u64 items_count{ null_render_item_ids.size() };
+        u8* const buffer{ (u8*) core::frame_arena().allocate(items_count * struct_size) };
+
+        entity_ids            = (id::id_type*) buffer;
+        submesh_gpu_ids       = (id::id_type*) &entity_ids[items_count];
+        material_ids          = (id::id_type*) &submesh_gpu_ids[items_count];
+        gpass_pipeline_states = (id::id_type*) &material_ids[items_count];
+        depth_pipeline_states = (id::id_type*) &gpass_pipeline_states[items_count];
+        root_signatures       = (id::id_type*) &depth_pipeline_states[items_count];
+        material_types        = (material_type::type*) &root_signatures[items_count];
+        position_buffers      = (null_gpu_address*) &material_types[items_count];
+        element_buffers       = (null_gpu_address*) &position_buffers[items_count];
+        index_counts          = (u32*) &element_buffers[items_count];
+        primitive_topologies  = (primitive_topology::type*) &index_counts[items_count];
+        elements_types        = (u32*) &primitive_topologies[items_count];
+        per_object_data       = (null_gpu_address*) &elements_types[items_count];
+    }
+
+private:
+    constexpr static u32 struct_size{
+        id::size +                         // entity_ids
+        id::size +                         // submesh_ids
+        id::size +                         // material_ids
+        id::size +                         // gpass_pipeline_states
+        id::size +                         // depth_pipeline_states
+        id::size +                         // root_signatures
+        sizeof(material_type::type) +      // material_types
+        sizeof(null_gpu_address) +         // position_buffers
+        sizeof(null_gpu_address) +         // element_buffers
+        sizeof(u32) +                      // index_counts
+        sizeof(primitive_topology::type) + // primitive_topologies
+        sizeof(u32) +                      // elements_types
+        sizeof(null_gpu_address)           // per_object_data
+    };
+} frame_cache;
+
+#undef CONSTEXPR
+
+// Stand-in for a command list. Only tracks what d3d12 would have been asked to record
+struct null_command_list
+{
+    id::id_type root_signature{ id::invalid_id };
+    id::id_type pipeline_state{ id::invalid_id };
+    draw_stats* stats{ nullptr };
+
+    void set_root_signature(id::id_type id)
+    {
+        root_signature = id;
+        ++stats->state_changes;
+    }
+
+    void set_pipeline_state(id::id_type id)
+    {
+        pipeline_state = id;
+        ++stats->state_changes;
+    }
+
+    // The addresses are folded together and reported with the frame timings, so the loads can't be optimized away
+    void bind(null_gpu_address address)
+    {
+        ++stats->bind_count;
+        stats->bound_addresses ^= address;
+    }
+
+    void draw_indexed(u32 index_count)
+    {
+        ++stats->draw_count;
+        stats->index_count += index_count;
+    }
+};
+
+void set_root_parameters(null_command_list& cmd_list, u32 cache_index)
+{
+    const gpass_cache& cache{ frame_cache };
+    assert(cache_index < cache.size());
+
+    const material_type::type mtl_type{ cache.material_types[cache_index] };
+
+    switch (mtl_type)
+    {
+    case material_type::opaque:
+    {
+        cmd_list.bind(cache.position_buffers[cache_index]);
+        cmd_list.bind(cache.element_buffers[cache_index]);
+        cmd_list.bind(cache.per_object_data[cache_index]);
+    }
+    break;
+    }
+}
+
+} // anonymous namespace
+
+bool initialize()
+{
+    return true;
+}
+
+void shutdown()
+{
+    dimensions = initial_dimensions;
+}
+
+void set_size(vec2u size)
+{
+    vec2u& d = dimensions;
+
+    if (size.x > d.x || size.y > d.y)
+    {
+        d = { std::max(size.x, d.x), std::max(size.y, d.y) };
+    }
+}
+
+void resolve_render_items(const null_frame_info& null_info)
+{
+    assert(null_info.info && null_info.camera);
+    assert(null_info.info->render_item_ids && null_info.info->render_item_count);
+    gpass_cache& cache{ frame_cache };
+    cache.clear();
+
+    content::render_item::get_null_render_item_ids(*null_info.info, cache.null_render_item_ids);
+    cache.resize();
+}
+
+void fetch_render_items()
+{
+    const gpass_cache& cache{ frame_cache };
+
+    using namespace content;
+
+    const u32                      items_count{ cache.size() };
+    const render_item::items_cache items_cache{ cache.items_cache() };
+    render_item::get_items(cache.null_render_item_ids.data(), items_count, items_cache);
+
+    const submesh::views_cache views_cache{ cache.views_cache() };
+    submesh::get_views(items_cache.submesh_gpu_ids, items_count, views_cache);
+
+    const material::materials_cache materials_cache{ cache.materials_cache() };
+    material::get_materials(items_cache.material_ids, items_count, materials_cache);
+}
+
+void fill_per_object_data(const null_frame_info& null_info)
+{
+    const gpass_cache&   cache{ frame_cache };
+    const u32            render_items_count{ cache.size() };
+    id::id_type          current_entity_id{ id::invalid_id };
+    hlsl::PerObjectData* current_data_ptr{ nullptr };
+
+    null_constant_buffer& cbuffer{ core::cbuffer() };
+
+    using namespace DirectX;
+    for (u32 i{ 0 }; i < render_items_count; ++i)
+    {
+        if (current_entity_id != cache.entity_ids[i])
+        {
+            current_entity_id = cache.entity_ids[i];
+            hlsl::PerObjectData data{};
+            transform::get_transform_matrices(game_entity::entity_id{ current_entity_id }, data.World, data.InvWorld);
+            const mat world{ XMLoadFloat4x4(&data.World) };
+            const mat mvp{ XMMatrixMultiply(world, null_info.camera->view_projection()) };
+            XMStoreFloat4x4(&data.WorldViewProjection, mvp);
+
+            current_data_ptr = cbuffer.allocate<hlsl::PerObjectData>();
+            memcpy(current_data_ptr, &data, sizeof(hlsl::PerObjectData));
+        }
+
+        assert(current_data_ptr);
+        cache.per_object_data[i] = cbuffer.gpu_address(current_data_ptr);
+    }
+}
+
+void depth_prepass(const null_frame_info& null_info, draw_stats& stats)
+{
+    const gpass_cache& cache{ frame_cache };
+    const u32          items_count{ cache.size() };
+
+    null_command_list cmd_list{};
+    cmd_list.stats = &stats;
+
+    for (u32 i{ 0 }; i < items_count; ++i)
+    {
+        if (cmd_list.root_signature != cache.root_signatures[i])
+        {
+            cmd_list.set_root_signature(cache.root_signatures[i]);
+            cmd_list.bind(null_info.global_shader_data);
+        }
+
+        if (cmd_list.pipeline_state != cache.depth_pipeline_states[i])
+        {
+            cmd_list.set_pipeline_state(cache.depth_pipeline_states[i]);
+        }
+
+        set_root_parameters(cmd_list, i);
+        cmd_list.draw_indexed(cache.index_counts[i]);
+    }
+}
+
+void render(const null_frame_info& null_info, draw_stats& stats)
+{
+    const gpass_cache& cache{ frame_cache };
+    const u32          items_count{ cache.size() };
+
+    null_command_list cmd_list{};
+    cmd_list.stats = &stats;
+
+    for (u32 i{ 0 }; i < items_count; ++i)
+    {
+        if (cmd_list.root_signature != cache.root_signatures[i])
+        {
+            cmd_list.set_root_signature(cache.root_signatures[i]);
+            cmd_list.bind(null_info.global_shader_data);
+            cmd_list.bind(light::non_cullable_light_buffer(null_info.frame_index));
+        }
+
+        if (cmd_list.pipeline_state != cache.gpass_pipeline_states[i])
+        {
+            cmd_list.set_pipeline_state(cache.gpass_pipeline_states[i]);
+        }
+
+        set_root_parameters(cmd_list, i);
+        cmd_list.draw_indexed(cache.index_counts[i]);
+    }
+}
+
+u32 render_item_count()
+{
+    return frame_cache.size();
+}
+
+} // namespace lotus::graphics::null::gpass
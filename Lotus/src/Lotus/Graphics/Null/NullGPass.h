@@ -0,0 +1,61 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: NullGPass.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+
+#pragma once
+
+
+#include "NullCommon.h"
+
+namespace lotus::graphics::null
+{
+struct null_frame_info;
+}
+
+namespace lotus::graphics::null::gpass
+{
+
+// What the d3d12 gpass would have recorded into its command list
+struct draw_stats
+{
+    u32 draw_count{};
+    u32 state_changes{};
+    u64 index_count{};
+    u32 bind_count{};
+    u64 bound_addresses{}; // every bound address xor'ed together
+};
+
+bool initialize();
+void shutdown();
+
+void set_size(vec2u size);
+
+// The cpu side stages of d3d12::gpass::depth_prepass and d3d12::gpass::render, split up so they can be timed individually
+void resolve_render_items(const null_frame_info& null_info);
+void fetch_render_items();
+void fill_per_object_data(const null_frame_info& null_info);
+void depth_prepass(const null_frame_info& null_info, draw_stats& stats);
+void render(const null_frame_info& null_info, draw_stats& stats);
+
+[[nodiscard]] u32 render_item_count();
+
+} // namespace lotus::graphics::null::gpass
@@ -0,0 +1,49 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: NullLight.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+
+#pragma once
+
+
+#include "NullCommon.h"
+
+namespace lotus::graphics::null
+{
+struct null_frame_info;
+}
+namespace lotus::graphics::null::light
+{
+
+bool initialize();
+void shutdown();
+
+graphics::light create(light_init_info info);
+void            remove(light_id id, u64 light_set_key);
+void set_parameter(light_id id, u64 light_set_key, light_parameter::parameter param, const void* const data, u32 data_size);
+void get_parameter(light_id id, u64 light_set_key, light_parameter::parameter param, void* const data, u32 data_size);
+
+
+void             update_light_buffers(const null_frame_info& null_info);
+null_gpu_address non_cullable_light_buffer(u32 frame_index);
+u32              non_cullable_light_count(u64 light_set_key);
+
+} // namespace lotus::graphics::null::light
@@ -25,6 +25,7 @@
 
 #include "GraphicsPlatformInterface.h"
 #include "D3D12/D3D12Interface.h"
+#include "Null/NullInterface.h"
 
 namespace lotus::graphics
 {
@@ -34,6 +35,7 @@ platform_interface gfx{};
 
 constexpr const char* engine_shader_paths[]{
     R"(.\shaders\d3d12\shaders.bin)",
+    R"(.\shaders\d3d12\shaders.bin)", // null has no shaders of its own, but content loading expects the engine shaders
 };
 
 bool set_platform_interface(graphics_platform platform, platform_interface& pinterface)
@@ -41,6 +43,7 @@ bool set_platform_interface(graphics_platform platform, platform_interface& pint
     switch (platform)
     {
     case graphics_platform::d3d12: d3d12::get_platform_interface(pinterface); break;
+    case graphics_platform::null: null::get_platform_interface(pinterface); break;
     default: return false;
     }
 
@@ -267,7 +267,8 @@ struct primitive_topology
 enum class graphics_platform : u32
 {
     d3d12 = 0,
-    //TODO: vulkan = 1
+    null  = 1, // headless, runs the cpu side of frame preparation without a gpu
+    //TODO: vulkan = 2
 };
 
 bool initialize(graphics_platform platform);
@@ -0,0 +1,137 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: Allocator.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "../Common.h"
+
+#include <atomic>
+
+namespace lotus::utl
+{
+
+// Allocator policies for utl::vector and utl::free_list. A policy is a type with a static reallocate and deallocate, so
+// containers don't grow in size and the default policy compiles down to the plain realloc/free calls
+struct default_allocator
+{
+    static void* reallocate(void* block, [[maybe_unused]] u64 old_size, u64 new_size) { return realloc(block, new_size); }
+    static void  deallocate(void* block, [[maybe_unused]] u64 size) { free(block); }
+};
+
+namespace memory_tag
+{
+enum type : u32
+{
+    general,
+    entities,
+    transforms,
+    scripts,
+    content,
+    lights,
+
+    count
+};
+} // namespace memory_tag
+
+struct memory_stats
+{
+    u64 live_bytes{};       // bytes currently allocated
+    u64 peak_bytes{};       // highest live_bytes so far
+    u64 live_allocations{}; // blocks currently allocated
+    u64 allocation_count{}; // calls that allocated or grew a block
+};
+
+namespace detail
+{
+struct alignas(64) tag_counters
+{
+    std::atomic<u64> live_bytes{ 0 };
+    std::atomic<u64> peak_bytes{ 0 };
+    std::atomic<u64> live_allocations{ 0 };
+    std::atomic<u64> allocation_count{ 0 };
+};
+
+inline tag_counters memory_counters[memory_tag::count]{};
+
+inline void track_reallocate(memory_tag::type tag, bool is_new_block, u64 old_size, u64 new_size)
+{
+    tag_counters& counters{ memory_counters[tag] };
+    const u64     live{ counters.live_bytes.fetch_add(new_size - old_size, std::memory_order_relaxed) + new_size - old_size };
+    u64           peak{ counters.peak_bytes.load(std::memory_order_relaxed) };
+    while (live > peak && !counters.peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+
+    if (is_new_block)
+        counters.live_allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.allocation_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void track_deallocate(memory_tag::type tag, u64 size)
+{
+    tag_counters& counters{ memory_counters[tag] };
+    counters.live_bytes.fetch_sub(size, std::memory_order_relaxed);
+    counters.live_allocations.fetch_sub(1, std::memory_order_relaxed);
+}
+} // namespace detail
+
+// Same as default_allocator, but accounts every block to a subsystem tag that can be queried with get_memory_stats
+template<memory_tag::type tag>
+struct tracking_allocator
+{
+    static_assert(tag < memory_tag::count);
+
+    static void* reallocate(void* block, u64 old_size, u64 new_size)
+    {
+        void* const new_block{ realloc(block, new_size) };
+        if (new_block)
+        {
+            detail::track_reallocate(tag, !block, block ? old_size : 0, new_size);
+        }
+        return new_block;
+    }
+
+    static void deallocate(void* block, u64 size)
+    {
+        if (!block)
+            return;
+        free(block);
+        detail::track_deallocate(tag, size);
+    }
+};
+
+[[nodiscard]] inline memory_stats get_memory_stats(memory_tag::type tag)
+{
+    assert(tag < memory_tag::count);
+    const detail::tag_counters& counters{ detail::memory_counters[tag] };
+    return { counters.live_bytes.load(std::memory_order_relaxed), counters.peak_bytes.load(std::memory_order_relaxed),
+             counters.live_allocations.load(std::memory_order_relaxed),
+             counters.allocation_count.load(std::memory_order_relaxed) };
+}
+
+[[nodiscard]] constexpr const char* memory_tag_name(memory_tag::type tag)
+{
+    constexpr const char* names[memory_tag::count]{ "general", "entities", "transforms", "scripts", "content", "lights" };
+    assert(tag < memory_tag::count);
+    return names[tag];
+}
+
+} // namespace lotus::utl
@@ -0,0 +1,284 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: ChunkedVector.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "../Common.h"
+#include "Allocator.h"
+
+#include <algorithm>
+
+namespace lotus::utl
+{
+
+// Vector that stores its items in fixed size pages. Growing only ever adds a page, so items are never moved or copied
+// and pointers and references to them stay valid until they are removed. Indexing is a shift and a mask into the page
+// table, so it stays O(1), but the items aren't contiguous past a page. Use for_each_page for bulk access
+template<typename T, u32 page_bits = 10, typename Allocator = default_allocator>
+class chunked_vector
+{
+public:
+    constexpr static u64 page_size{ 1ull << page_bits };
+    constexpr static u64 page_mask{ page_size - 1 };
+
+    // Pages come from realloc, which only guarantees 16 byte alignment
+    static_assert(alignof(T) <= 16);
+
+    chunked_vector() = default;
+
+    explicit chunked_vector(u64 count) { resize(count); }
+
+    explicit chunked_vector(u64 count, const T& value) { resize(count, value); }
+
+    chunked_vector(const chunked_vector& o) { *this = o; }
+
+    chunked_vector(chunked_vector&& o) noexcept : m_pages{ std::move(o.m_pages) }, m_size{ o.m_size } { o.m_size = 0; }
+
+    ~chunked_vector() { destroy(); }
+
+    chunked_vector& operator=(const chunked_vector& o)
+    {
+        assert(this != std::addressof(o));
+        if (this != std::addressof(o))
+        {
+            clear();
+            reserve(o.m_size);
+            for (const T& item : o)
+            {
+                emplace_back(item);
+            }
+        }
+
+        return *this;
+    }
+
+    chunked_vector& operator=(chunked_vector&& o) noexcept
+    {
+        assert(this != std::addressof(o));
+        if (this != std::addressof(o))
+        {
+            destroy();
+            m_pages  = std::move(o.m_pages);
+            m_size   = o.m_size;
+            o.m_size = 0;
+        }
+
+        return *this;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template<typename... Params>
+    decltype(auto) emplace_back(Params&&... p)
+    {
+        if (m_size == capacity())
+        {
+            add_page();
+        }
+        assert(m_size < capacity());
+
+        T* const item{ new (address(m_size)) T(std::forward<Params>(p)...) };
+        ++m_size;
+        return *item;
+    }
+
+    void pop_back()
+    {
+        assert(m_size);
+        --m_size;
+        if constexpr (!std::is_trivially_destructible_v<T>)
+            address(m_size)->~T();
+    }
+
+    void resize(u64 new_size)
+    {
+        static_assert(std::is_default_constructible<T>::value, "Type must have a default constructor");
+
+        reserve(new_size);
+        while (m_size < new_size)
+        {
+            emplace_back();
+        }
+        while (m_size > new_size)
+        {
+            pop_back();
+        }
+    }
+
+    void resize(u64 new_size, const T& value)
+    {
+        static_assert(std::is_copy_constructible<T>::value, "Type must be copyable");
+
+        reserve(new_size);
+        while (m_size < new_size)
+        {
+            emplace_back(value);
+        }
+        while (m_size > new_size)
+        {
+            pop_back();
+        }
+    }
+
+    void reserve(u64 new_capacity)
+    {
+        while (capacity() < new_capacity)
+        {
+            add_page();
+        }
+    }
+
+    // Destroys every item but keeps the pages around for reuse
+    void clear()
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (u64 i{ 0 }; i < m_size; ++i)
+            {
+                address(i)->~T();
+            }
+        }
+        m_size = 0;
+    }
+
+    // Calls func(T* items, u64 count) once for every page that holds items, in order
+    template<typename Func>
+    void for_each_page(Func func)
+    {
+        for (u64 first{ 0 }; first < m_size; first += page_size)
+        {
+            func(m_pages[first >> page_bits], std::min(page_size, m_size - first));
+        }
+    }
+
+    template<typename Func>
+    void for_each_page(Func func) const
+    {
+        for (u64 first{ 0 }; first < m_size; first += page_size)
+        {
+            func((const T*) m_pages[first >> page_bits], std::min(page_size, m_size - first));
+        }
+    }
+
+    [[nodiscard]] bool empty() const { return m_size == 0; }
+
+    [[nodiscard]] u64 size() const { return m_size; }
+
+    [[nodiscard]] u64 capacity() const { return m_pages.size() << page_bits; }
+
+    [[nodiscard]] u64 page_count() const { return m_pages.size(); }
+
+    T& operator[](u64 index)
+    {
+        assert(index < m_size);
+        return *address(index);
+    }
+
+    const T& operator[](u64 index) const
+    {
+        assert(index < m_size);
+        return *address(index);
+    }
+
+    T& front()
+    {
+        assert(m_size);
+        return *address(0);
+    }
+
+    const T& front() const
+    {
+        assert(m_size);
+        return *address(0);
+    }
+
+    T& back()
+    {
+        assert(m_size);
+        return *address(m_size - 1);
+    }
+
+    const T& back() const
+    {
+        assert(m_size);
+        return *address(m_size - 1);
+    }
+
+    template<typename Vector, typename Item>
+    class page_iterator
+    {
+    public:
+        constexpr page_iterator(Vector* vector, u64 index) : m_vector{ vector }, m_index{ index } {}
+
+        [[nodiscard]] Item& operator*() const { return (*m_vector)[m_index]; }
+        [[nodiscard]] Item* operator->() const { return &(*m_vector)[m_index]; }
+
+        constexpr page_iterator& operator++()
+        {
+            ++m_index;
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const page_iterator& other) const { return m_index == other.m_index; }
+        [[nodiscard]] constexpr bool operator!=(const page_iterator& other) const { return m_index != other.m_index; }
+
+    private:
+        Vector* m_vector;
+        u64     m_index;
+    };
+
+    using iterator       = page_iterator<chunked_vector, T>;
+    using const_iterator = page_iterator<const chunked_vector, const T>;
+
+    iterator       begin() { return { this, 0 }; }
+    const_iterator begin() const { return { this, 0 }; }
+    iterator       end() { return { this, m_size }; }
+    const_iterator end() const { return { this, m_size }; }
+
+private:
+    [[nodiscard]] T* address(u64 index) const { return m_pages[index >> page_bits] + (index & page_mask); }
+
+    void add_page()
+    {
+        T* const page{ (T*) Allocator::reallocate(nullptr, 0, page_size * sizeof(T)) };
+        assert(page);
+        m_pages.emplace_back(page);
+    }
+
+    void destroy()
+    {
+        clear();
+        for (u64 i{ 0 }; i < m_pages.size(); ++i)
+        {
+            Allocator::deallocate(m_pages[i], page_size * sizeof(T));
+        }
+        m_pages.clear();
+    }
+
+    utl::vector<T*, true, Allocator> m_pages;
+    u64                              m_size{ 0 };
+};
+
+} // namespace lotus::utl
@@ -0,0 +1,197 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: ConcurrentFreeList.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "../Common.h"
+
+#include <atomic>
+
+namespace lotus::utl
+{
+
+// Thread safe counterpart to utl::free_list. add and remove are lock free and reading a live item is wait free.
+// Items live in fixed size chunks that are never moved or freed while the list exists, so other threads adding items
+// never invalidate a reference. Same as free_list though, an item must not be read while another thread removes it
+template<typename T, u32 chunk_bits = 10, u32 max_chunks = 4096>
+class concurrent_free_list
+{
+    constexpr static u32 chunk_size{ 1u << chunk_bits };
+    constexpr static u32 chunk_mask{ chunk_size - 1 };
+    constexpr static u32 max_items{ chunk_size * max_chunks };
+    // Stored as the next free index of a slot that holds a live item
+    constexpr static u32 live_marker{ invalid_id_u32 - 1 };
+
+    static_assert(max_items > 0 && max_items < live_marker);
+
+public:
+    concurrent_free_list() = default;
+    DISABLE_COPY_AND_MOVE(concurrent_free_list);
+
+    ~concurrent_free_list()
+    {
+        assert(!m_size);
+        for (auto& chunk : m_chunks)
+        {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    template<class... Params>
+    u32 add(Params&&... p)
+    {
+        u32 id{ pop_free() };
+        if (id == invalid_id_u32)
+        {
+            id = m_next_new_index.fetch_add(1, std::memory_order_relaxed);
+            assert(id < max_items);
+            ensure_chunk(id >> chunk_bits);
+        }
+
+        slot& s{ get_slot(id) };
+        new (s.storage) T(std::forward<Params>(p)...);
+        s.next.store(live_marker, std::memory_order_release);
+        m_size.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
+
+    void remove(u32 id)
+    {
+        assert(is_live(id));
+        slot& s{ get_slot(id) };
+        item(s).~T();
+        L_DBG(memset(s.storage, 0xcc, sizeof(T)));
+        push_free(id, s);
+        m_size.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool is_live(u32 id) const
+    {
+        if (id >= m_next_new_index.load(std::memory_order_acquire))
+            return false;
+        const slot* const chunk{ m_chunks[id >> chunk_bits].load(std::memory_order_acquire) };
+        return chunk && chunk[id & chunk_mask].next.load(std::memory_order_acquire) == live_marker;
+    }
+
+    // Calls func(id, item) for every item that is live when its slot is visited
+    template<typename Func>
+    void for_each_live(Func&& func)
+    {
+        const u32 count{ m_next_new_index.load(std::memory_order_acquire) };
+        for (u32 id{ 0 }; id < count; ++id)
+        {
+            if (is_live(id))
+            {
+                func(id, (*this)[id]);
+            }
+        }
+    }
+
+    [[nodiscard]] u32  size() const { return m_size.load(std::memory_order_relaxed); }
+    [[nodiscard]] u32  capacity() const { return m_next_new_index.load(std::memory_order_relaxed); }
+    [[nodiscard]] bool empty() const { return size() == 0; }
+
+    T& operator[](u32 id)
+    {
+        assert(is_live(id));
+        return item(get_slot(id));
+    }
+
+    const T& operator[](u32 id) const
+    {
+        assert(is_live(id));
+        return item(get_slot(id));
+    }
+
+private:
+    struct slot
+    {
+        alignas(T) u8 storage[sizeof(T)];
+        std::atomic<u32> next{ invalid_id_u32 };
+    };
+
+    [[nodiscard]] static T&       item(slot& s) { return *std::launder((T*) s.storage); }
+    [[nodiscard]] static const T& item(const slot& s) { return *std::launder((const T*) s.storage); }
+
+    [[nodiscard]] slot& get_slot(u32 id) const
+    {
+        slot* const chunk{ m_chunks[id >> chunk_bits].load(std::memory_order_acquire) };
+        assert(chunk);
+        return chunk[id & chunk_mask];
+    }
+
+    void ensure_chunk(u32 chunk_index)
+    {
+        assert(chunk_index < max_chunks);
+        if (m_chunks[chunk_index].load(std::memory_order_acquire))
+            return;
+
+        // Several threads can get here for the same chunk, only the first one to publish its chunk wins
+        slot* const chunk{ new slot[chunk_size] };
+        slot*       expected{ nullptr };
+        if (!m_chunks[chunk_index].compare_exchange_strong(expected, chunk, std::memory_order_acq_rel))
+        {
+            delete[] chunk;
+        }
+    }
+
+    // The free list is a stack threaded through the slots. The head packs a tag in the high 32 bits that changes on every
+    // push and pop, so a pop can't succeed with a next index that went stale while another thread popped and pushed
+    static constexpr u64 make_head(u64 old_head, u32 index) { return (((old_head >> 32) + 1) << 32) | index; }
+
+    void push_free(u32 id, slot& s)
+    {
+        u64 head{ m_free_head.load(std::memory_order_relaxed) };
+        u64 new_head;
+        do
+        {
+            s.next.store((u32) head, std::memory_order_relaxed);
+            new_head = make_head(head, id);
+        } while (!m_free_head.compare_exchange_weak(head, new_head, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    [[nodiscard]] u32 pop_free()
+    {
+        u64 head{ m_free_head.load(std::memory_order_acquire) };
+        for (;;)
+        {
+            const u32 id{ (u32) head };
+            if (id == invalid_id_u32)
+                return invalid_id_u32;
+
+            const u32 next{ get_slot(id).next.load(std::memory_order_relaxed) };
+            if (m_free_head.compare_exchange_weak(head, make_head(head, next), std::memory_order_acquire,
+                                                  std::memory_order_acquire))
+            {
+                return id;
+            }
+        }
+    }
+
+    std::atomic<slot*> m_chunks[max_chunks]{};
+    std::atomic<u64>   m_free_head{ invalid_id_u32 };
+    std::atomic<u32>   m_next_new_index{ 0 };
+    std::atomic<u32>   m_size{ 0 };
+};
+
+} // namespace lotus::utl
@@ -25,6 +25,8 @@
 
 #include "../Common.h"
 
+#include <bit>
+
 template<typename T>
 concept min_u32 = sizeof(T) >= sizeof(u32);
 
@@ -35,7 +37,7 @@ namespace lotus::utl
 #endif
 
 
-template<min_u32 T>
+template<min_u32 T, typename Allocator = default_allocator>
 class free_list
 {
     //static_assert(sizeof(T) >= sizeof(u32));
@@ -60,6 +62,10 @@ class free_list
         {
             id = (u32) m_array.size();
             m_array.emplace_back(std::forward<Params>(p)...);
+            if ((id >> 6) >= m_live.size())
+            {
+                m_live.emplace_back(0);
+            }
         } else
         {
             id = m_next_free_index;
@@ -67,6 +73,7 @@ class free_list
             m_next_free_index = *(const u32* const) std::addressof(m_array[id]);
             new (std::addressof(m_array[id])) T(std::forward<Params>(p)...);
         }
+        m_live[id >> 6] |= u64{ 1 } << (id & 63);
         ++m_size;
         return id;
     }
@@ -78,11 +85,105 @@ class free_list
         item.~T();
         L_DBG(memset(std::addressof(m_array[id]), 0xcc, sizeof(T)));
         *(u32* const) std::addressof(m_array[id]) = m_next_free_index;
+        m_live[id >> 6] &= ~(u64{ 1 } << (id & 63));
 
         m_next_free_index = id;
         --m_size;
     }
 
+    // O(1) in every build, unlike the debug only fill pattern check
+    [[nodiscard]] constexpr bool is_live(u32 id) const
+    {
+        return id < m_array.size() && (m_live[id >> 6] & (u64{ 1 } << (id & 63)));
+    }
+
+    // Calls func(id, item) for every live item in index order. Dead slots are skipped 64 at a time
+    template<typename Func>
+    constexpr void for_each_live(Func&& func)
+    {
+        const u32 word_count{ (u32) m_live.size() };
+        for (u32 word{ 0 }; word < word_count; ++word)
+        {
+            for (u64 bits{ m_live[word] }; bits; bits &= bits - 1)
+            {
+                const u32 id{ (word << 6) | (u32) std::countr_zero(bits) };
+                func(id, m_array[id]);
+            }
+        }
+    }
+
+    template<typename Func>
+    constexpr void for_each_live(Func&& func) const
+    {
+        const u32 word_count{ (u32) m_live.size() };
+        for (u32 word{ 0 }; word < word_count; ++word)
+        {
+            for (u64 bits{ m_live[word] }; bits; bits &= bits - 1)
+            {
+                const u32 id{ (word << 6) | (u32) std::countr_zero(bits) };
+                func(id, m_array[id]);
+            }
+        }
+    }
+
+    template<typename List, typename Item>
+    class live_iterator
+    {
+    public:
+        constexpr live_iterator(List* list, u32 id) : m_list{ list }, m_id{ id } { skip_dead(); }
+
+        [[nodiscard]] constexpr Item& operator*() const { return m_list->m_array[m_id]; }
+        [[nodiscard]] constexpr Item* operator->() const { return std::addressof(m_list->m_array[m_id]); }
+        [[nodiscard]] constexpr u32   index() const { return m_id; }
+
+        constexpr live_iterator& operator++()
+        {
+            ++m_id;
+            skip_dead();
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const live_iterator& other) const { return m_id == other.m_id; }
+        [[nodiscard]] constexpr bool operator!=(const live_iterator& other) const { return m_id != other.m_id; }
+
+    private:
+        // Moves to the first live id at or after m_id, or to the end
+        constexpr void skip_dead()
+        {
+            const u32 end{ (u32) m_list->m_array.size() };
+            u32       word{ m_id >> 6 };
+            if (m_id >= end)
+            {
+                m_id = end;
+                return;
+            }
+
+            u64 bits{ m_list->m_live[word] & (~u64{ 0 } << (m_id & 63)) };
+            while (!bits)
+            {
+                if (++word >= (u32) m_list->m_live.size())
+                {
+                    m_id = end;
+                    return;
+                }
+                bits = m_list->m_live[word];
+            }
+
+            m_id = (word << 6) | (u32) std::countr_zero(bits);
+        }
+
+        List* m_list;
+        u32   m_id;
+    };
+
+    using iterator       = live_iterator<free_list, T>;
+    using const_iterator = live_iterator<const free_list, const T>;
+
+    [[nodiscard]] constexpr iterator       begin() { return iterator{ this, 0 }; }
+    [[nodiscard]] constexpr iterator       end() { return iterator{ this, (u32) m_array.size() }; }
+    [[nodiscard]] constexpr const_iterator begin() const { return const_iterator{ this, 0 }; }
+    [[nodiscard]] constexpr const_iterator end() const { return const_iterator{ this, (u32) m_array.size() }; }
+
     [[nodiscard]] constexpr u32 size() const { return m_size; }
     [[nodiscard]] constexpr u32 capacity() const { return m_array.size(); }
 
@@ -102,25 +203,17 @@ class free_list
 
 
 private:
-    constexpr bool already_removed(u32 id) const
-    {
-        if constexpr (sizeof(T) > sizeof(u32))
-        {
-            u32        i = sizeof(u32);
-            const auto p = (const u8* const) std::addressof(m_array[id]);
-            while (p[i] == 0xcc && i < sizeof(T))
-                ++i;
-            return i == sizeof(T);
-        } else
-            return true;
-    }
+    constexpr bool already_removed(u32 id) const { return !is_live(id); }
 
 #if USE_STL_VECTOR
     utl::vector<T> m_array;
 #else
-    utl::vector<T, false> m_array;
+    utl::vector<T, false, Allocator> m_array;
 #endif
 
+    // One bit per slot in m_array, set while the slot holds a live item
+    utl::vector<u64, true, Allocator> m_live;
+
     u32 m_next_free_index{ invalid_id_u32 };
     u32 m_size{ 0 };
 };
@@ -0,0 +1,155 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: LinearArena.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "../Common.h"
+
+#include <atomic>
+
+namespace lotus::utl
+{
+
+// Bump allocator for data that only has to live until the arena is reset, normally once per frame. allocate can be
+// called from any thread, reset can't and must only happen once nothing allocated since the last reset is in use.
+// Memory is not initialized and destructors are never called. Allocations that don't fit go into overflow blocks
+// which are freed on the next reset, which also grows the arena so a frame like that one fits from then on
+class linear_arena
+{
+public:
+    constexpr static u64 default_alignment{ 16 };
+
+    struct statistics
+    {
+        u64 capacity{};        // size of the main block
+        u64 used{};            // bytes allocated since the last reset, including overflow
+        u64 high_water_mark{}; // most bytes used between two resets
+        u32 overflow_count{};  // allocations since the last reset that didn't fit in the main block
+        u32 grow_count{};      // times the main block was grown because of overflow
+    };
+
+    linear_arena() = default;
+    explicit linear_arena(u64 capacity) { reserve(capacity); }
+    DISABLE_COPY_AND_MOVE(linear_arena);
+    ~linear_arena() { release(); }
+
+    // Not thread safe, the arena must be empty
+    void reserve(u64 capacity)
+    {
+        assert(!m_offset && m_overflow.empty());
+        if (capacity <= m_capacity)
+            return;
+
+        free(m_buffer);
+        m_buffer = (u8*) malloc(capacity);
+        assert(m_buffer);
+        m_capacity = m_buffer ? capacity : 0;
+    }
+
+    void release()
+    {
+        reset();
+        free(m_buffer);
+        m_buffer   = nullptr;
+        m_capacity = 0;
+    }
+
+    [[nodiscard]] void* allocate(u64 size, u64 alignment = default_alignment)
+    {
+        assert(size && alignment && !(alignment & (alignment - 1)));
+        const uintptr_t base{ (uintptr_t) m_buffer };
+        u64             offset{ m_offset.load(std::memory_order_relaxed) };
+        u64             aligned_offset;
+        do
+        {
+            aligned_offset = ((base + offset + alignment - 1) & ~(alignment - 1)) - base;
+            if (aligned_offset + size > m_capacity)
+                return allocate_overflow(size, alignment);
+        } while (!m_offset.compare_exchange_weak(offset, aligned_offset + size, std::memory_order_relaxed));
+
+        return m_buffer + aligned_offset;
+    }
+
+    template<typename T>
+    [[nodiscard]] T* allocate(u64 count = 1)
+    {
+        return (T*) allocate(sizeof(T) * count, alignof(T) > default_alignment ? alignof(T) : default_alignment);
+    }
+
+    // Drops every allocation in O(1) unless the last frame overflowed
+    void reset()
+    {
+        const u64 used{ m_offset.load(std::memory_order_relaxed) + m_overflow_bytes };
+        if (used > m_high_water_mark)
+            m_high_water_mark = used;
+
+        m_offset.store(0, std::memory_order_relaxed);
+        if (!m_overflow.empty())
+        {
+            for (u8* const block : m_overflow)
+            {
+                free(block);
+            }
+            m_overflow.clear();
+            m_overflow_bytes = 0;
+            m_overflow_count = 0;
+
+            reserve(m_capacity * 2 > m_high_water_mark ? m_capacity * 2 : m_high_water_mark);
+            ++m_grow_count;
+        }
+    }
+
+    [[nodiscard]] statistics stats() const
+    {
+        return { m_capacity, m_offset.load(std::memory_order_relaxed) + m_overflow_bytes, m_high_water_mark,
+                 m_overflow_count, m_grow_count };
+    }
+
+private:
+    void* allocate_overflow(u64 size, u64 alignment)
+    {
+        std::lock_guard lock{ m_overflow_mutex };
+        u8* const       block{ (u8*) malloc(size + alignment - 1) };
+        assert(block);
+        if (!block)
+            return nullptr;
+
+        m_overflow.emplace_back(block);
+        m_overflow_bytes += size;
+        ++m_overflow_count;
+        return (void*) (((uintptr_t) block + alignment - 1) & ~(alignment - 1));
+    }
+
+    u8*              m_buffer{ nullptr };
+    u64              m_capacity{ 0 };
+    std::atomic<u64> m_offset{ 0 };
+    u64              m_high_water_mark{ 0 };
+    u32              m_grow_count{ 0 };
+
+    std::mutex       m_overflow_mutex;
+    utl::vector<u8*> m_overflow;
+    u64              m_overflow_bytes{ 0 };
+    u32              m_overflow_count{ 0 };
+};
+
+} // namespace lotus::utl
@@ -0,0 +1,129 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: ObjectPool.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "../Common.h"
+#include "Allocator.h"
+
+namespace lotus::utl
+{
+
+// Storage for single objects of one type, carved out of slabs of slab_size objects. Destroyed objects leave their slot
+// on a free list that create takes from before allocating another slab, and slabs are only freed with the pool, so
+// creating and destroying objects over and over doesn't go to the heap. The most recently freed slot is reused first
+// since it's the most likely to still be in cache. Not thread safe
+template<typename T, u32 slab_size = 64, typename Allocator = default_allocator>
+class object_pool
+{
+public:
+    // Slabs come from realloc, which only guarantees 16 byte alignment
+    static_assert(alignof(T) <= 16);
+    static_assert(slab_size);
+
+    object_pool() = default;
+    DISABLE_COPY_AND_MOVE(object_pool);
+
+    ~object_pool()
+    {
+        assert(!m_size);
+        release();
+    }
+
+    template<class... Params>
+    [[nodiscard]] T* create(Params&&... p)
+    {
+        if (!m_free)
+        {
+            add_slab();
+        }
+
+        slot* const s{ m_free };
+        m_free = s->next;
+        ++m_size;
+        return new (s->storage) T(std::forward<Params>(p)...);
+    }
+
+    void destroy(T* object)
+    {
+        assert(object && m_size);
+        object->~T();
+
+        slot* const s{ (slot*) object };
+        s->next = m_free;
+        m_free  = s;
+        --m_size;
+    }
+
+    // Frees every slab. Only allowed when all objects have been destroyed
+    void release()
+    {
+        assert(!m_size);
+        while (m_slabs)
+        {
+            slab* const next{ m_slabs->next };
+            Allocator::deallocate(m_slabs, sizeof(slab));
+            m_slabs = next;
+        }
+        m_free       = nullptr;
+        m_slab_count = 0;
+    }
+
+    [[nodiscard]] u32 size() const { return m_size; }
+    [[nodiscard]] u32 capacity() const { return m_slab_count * slab_size; }
+
+private:
+    union slot
+    {
+        slot* next;
+        alignas(T) u8 storage[sizeof(T)];
+    };
+
+    struct slab
+    {
+        slab* next;
+        slot  slots[slab_size];
+    };
+
+    void add_slab()
+    {
+        slab* const new_slab{ (slab*) Allocator::reallocate(nullptr, 0, sizeof(slab)) };
+        assert(new_slab);
+        new_slab->next = m_slabs;
+        m_slabs        = new_slab;
+        ++m_slab_count;
+
+        // Linked back to front so objects are handed out in address order
+        for (u32 i{ slab_size }; i > 0; --i)
+        {
+            new_slab->slots[i - 1].next = m_free;
+            m_free                      = &new_slab->slots[i - 1];
+        }
+    }
+
+    slab* m_slabs{ nullptr };
+    slot* m_free{ nullptr };
+    u32   m_size{ 0 };
+    u32   m_slab_count{ 0 };
+};
+
+} // namespace lotus::utl
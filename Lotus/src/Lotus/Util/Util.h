@@ -25,12 +25,15 @@
 #define USE_STL_VECTOR 0
 #define USE_STL_DEQUE  1
 
+#include "Allocator.h"
+
 #if USE_STL_VECTOR
     #include <vector>
     #include <algorithm>
 namespace lotus::utl
 {
-template<typename T>
+// Allocator policies are ignored when using std::vector
+template<typename T, bool destruct = true, typename Allocator = default_allocator>
 using vector = std::vector<T>;
 
 template<typename T>
@@ -73,6 +76,10 @@ using deque = std::deque<T>;
 
 
 #include "FreeList.h"
+#include "ConcurrentFreeList.h"
+#include "LinearArena.h"
+#include "ObjectPool.h"
+#include "ChunkedVector.h"
 
 namespace lotus::utl
 {
@@ -24,11 +24,12 @@
 #pragma once
 
 #include "../Common.h"
+#include "Allocator.h"
 
 namespace lotus::utl
 {
 
-template<typename T, bool destruct = true>
+template<typename T, bool destruct = true, typename Allocator = default_allocator>
 class vector
 {
 public:
@@ -157,7 +158,7 @@ class vector
         if (new_capacity <= m_capacity)
             return;
 
-        void* new_buffer = realloc(m_data, new_capacity * sizeof(T));
+        void* new_buffer = Allocator::reallocate(m_data, m_capacity * sizeof(T), new_capacity * sizeof(T));
         assert(new_buffer);
         if (new_buffer)
         {
@@ -327,10 +328,10 @@ class vector
     {
         assert([&] { return m_capacity ? m_data != nullptr : m_data == nullptr; }());
         clear();
-        m_capacity = 0;
         if (m_data)
-            free(m_data);
-        m_data = nullptr;
+            Allocator::deallocate(m_data, m_capacity * sizeof(T));
+        m_capacity = 0;
+        m_data     = nullptr;
     }
 
     u64 m_capacity{ 0 };
@@ -106,6 +106,15 @@ class GeometryImportSettings : ViewModelBase
         private bool _importAnimations;
         public bool ImportAnimations { get => _importAnimations; set { if (_importAnimations == value) return; _importAnimations = value; OnPropertyChanged(nameof(ImportAnimations)); } }
 
+        private bool _optimizeVertexCache;
+        public bool OptimizeVertexCache { get => _optimizeVertexCache; set { if (_optimizeVertexCache == value) return; _optimizeVertexCache = value; OnPropertyChanged(nameof(OptimizeVertexCache)); } }
+
+        private bool _optimizeOverdraw;
+        public bool OptimizeOverdraw { get => _optimizeOverdraw; set { if (_optimizeOverdraw == value) return; _optimizeOverdraw = value; OnPropertyChanged(nameof(OptimizeOverdraw)); } }
+
+        private int _generatedLods;
+        public int GeneratedLods { get => _generatedLods; set { if (_generatedLods == value) return; _generatedLods = value; OnPropertyChanged(nameof(GeneratedLods)); } }
+
         public GeometryImportSettings()
         {
             SmoothingAngle = 178f;
@@ -114,6 +123,9 @@ public GeometryImportSettings()
             ReverseHandedness = false;
             ImportEmbededTextures = true;
             ImportAnimations = true;
+            OptimizeVertexCache = true;
+            OptimizeOverdraw = true;
+            GeneratedLods = 3;
         }
 
         public void ToBinary(BinaryWriter writer)
@@ -20,6 +20,9 @@ class GeometryImportSettings
         public byte ReverseHandedness = 0;
         public byte ImportEmbededTextures = 1;
         public byte ImportAnimations = 1;
+        public byte OptimizeVertexCache = 1;
+        public byte OptimizeOverdraw = 1;
+        public byte GeneratedLods = 0;
 
         public void FromContentSettings(Content.Geometry geometry)
         {
@@ -31,17 +34,30 @@ public void FromContentSettings(Content.Geometry geometry)
             ReverseHandedness = ToByte(settings.ReverseHandedness);
             ImportEmbededTextures = ToByte(settings.ImportEmbededTextures);
             ImportAnimations = ToByte(settings.ImportAnimations);
+            OptimizeVertexCache = ToByte(settings.OptimizeVertexCache);
+            OptimizeOverdraw = ToByte(settings.OptimizeOverdraw);
+            GeneratedLods = (byte)settings.GeneratedLods;
         }
 
         private byte ToByte(bool val) => val ? (byte)1 : (byte)0;
     }
 
+    [StructLayout(LayoutKind.Sequential)]
+    class VertexCacheStats
+    {
+        public float AcmrBefore;
+        public float AtvrBefore;
+        public float AcmrAfter;
+        public float AtvrAfter;
+    }
+
     [StructLayout(LayoutKind.Sequential)]
     class SceneData : IDisposable
     {
         public IntPtr Data;
         public int DataSize;
         public GeometryImportSettings ImportSettings = new();
+        public VertexCacheStats CacheStats = new();
 
 
         ~SceneData()
@@ -93,6 +109,12 @@ static class ContentToolsAPI
                 var data = new byte[sceneData.DataSize];
                 Marshal.Copy(sceneData.Data, data, 0, sceneData.DataSize);
                 geometry.FromRawData(data);
+
+                var stats = sceneData.CacheStats;
+                if (stats.AcmrAfter > 0f)
+                {
+                    Logger.Info($"Vertex cache: ACMR {stats.AcmrBefore:F3} -> {stats.AcmrAfter:F3}, ATVR {stats.AtvrBefore:F3} -> {stats.AtvrAfter:F3}");
+                }
             }
             catch (Exception ex)
             {
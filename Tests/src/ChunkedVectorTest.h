@@ -0,0 +1,104 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: ChunkedVectorTest.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "Test.h"
+
+#include <Lotus/Common.h>
+
+#include <iostream>
+
+using namespace lotus;
+
+// Grows a utl::vector and a utl::chunked_vector of world matrices one item at a time, the way transform::create grows
+// the transform arrays, then reads them back
+class EngineTest : public Test
+{
+public:
+    bool Init() override { return true; }
+
+    void Run() override
+    {
+        do
+        {
+            const results vector_results{ run<utl::vector<mat4>>() };
+            const results chunked_results{ run<utl::chunked_vector<mat4>>() };
+
+            std::cout << item_count << " world matrices\n";
+            print("vector:        ", vector_results);
+            print("chunked_vector:", chunked_results);
+        } while (getchar() != 'q');
+    }
+
+    void Shutdown() override {}
+
+private:
+    struct results
+    {
+        f32 grow_ms{};
+        f32 worst_add_ms{};
+        f32 read_ms{};
+    };
+
+    template<typename Vector>
+    results run()
+    {
+        using clock = std::chrono::high_resolution_clock;
+
+        results r{};
+        Vector  items;
+
+        const auto grow_start = clock::now();
+        for (u32 i = 0; i < item_count; ++i)
+        {
+            const auto add_start = clock::now();
+            items.emplace_back(mat4{});
+            const f32 add_ms = std::chrono::duration<f32, std::milli>(clock::now() - add_start).count();
+            r.worst_add_ms   = std::max(r.worst_add_ms, add_ms);
+        }
+        r.grow_ms = std::chrono::duration<f32, std::milli>(clock::now() - grow_start).count();
+
+        f32        sum        = 0.0f;
+        const auto read_start = clock::now();
+        for (u32 i = 0; i < item_count; ++i)
+        {
+            sum += items[i]._44;
+        }
+        r.read_ms = std::chrono::duration<f32, std::milli>(clock::now() - read_start).count();
+
+        // Keeps the reads from being optimized out
+        if (sum < 0.0f)
+            std::cout << "";
+
+        return r;
+    }
+
+    static void print(const char* name, const results& r)
+    {
+        std::cout << "  " << name << " grow " << r.grow_ms << " ms, worst single add " << r.worst_add_ms << " ms, read "
+                  << r.read_ms << " ms\n";
+    }
+
+    constexpr static u32 item_count = 1'000'000;
+};
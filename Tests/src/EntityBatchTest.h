@@ -0,0 +1,122 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: EntityBatchTest.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Test.h"
+
+#include <Lotus/Components/Entity.h>
+#include <Lotus/Components/Transform.h>
+
+#include <iostream>
+
+using namespace lotus;
+
+// Loads and unloads a level's worth of entities one at a time, then with create_batch and remove_batch
+class EngineTest : public Test
+{
+public:
+    bool Init() override
+    {
+        m_transform_info.position[0] = 1.0f;
+        m_transform_info.rotation[3] = 1.0f;
+        m_infos.resize(entity_count, game_entity::create_info{ &m_transform_info, nullptr });
+        m_entities.resize(entity_count);
+        return true;
+    }
+
+    void Run() override
+    {
+        do
+        {
+            const results single_results{ run_single() };
+            const results batch_results{ run_batch() };
+
+            std::cout << entity_count << " entities\n";
+            print("single:", single_results);
+            print("batch: ", batch_results);
+        } while (getchar() != 'q');
+    }
+
+    void Shutdown() override {}
+
+private:
+    struct results
+    {
+        f32 create_ms{};
+        f32 remove_ms{};
+    };
+
+    results run_single()
+    {
+        results r{};
+
+        const auto create_start = clock::now();
+        for (u32 i = 0; i < entity_count; ++i)
+        {
+            m_entities[i] = game_entity::create(m_infos[i]);
+        }
+        r.create_ms = ms_since(create_start);
+
+        const auto remove_start = clock::now();
+        for (u32 i = 0; i < entity_count; ++i)
+        {
+            game_entity::remove(m_entities[i].get_id());
+        }
+        r.remove_ms = ms_since(remove_start);
+
+        return r;
+    }
+
+    results run_batch()
+    {
+        results r{};
+
+        const auto create_start = clock::now();
+        game_entity::create_batch(m_infos.data(), entity_count, m_entities.data());
+        r.create_ms = ms_since(create_start);
+
+        const auto remove_start = clock::now();
+        game_entity::remove_batch(m_entities.data(), entity_count);
+        r.remove_ms = ms_since(remove_start);
+
+        return r;
+    }
+
+    using clock = std::chrono::high_resolution_clock;
+
+    static f32 ms_since(clock::time_point start)
+    {
+        return std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+    }
+
+    static void print(const char* name, const results& r)
+    {
+        std::cout << "  " << name << " create " << r.create_ms << " ms, remove " << r.remove_ms << " ms\n";
+    }
+
+    constexpr static u32 entity_count = 200'000;
+
+    transform::create_info                m_transform_info{};
+    utl::vector<game_entity::create_info> m_infos;
+    utl::vector<game_entity::entity>      m_entities;
+};
@@ -0,0 +1,173 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: FreeListContentionTest.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "Test.h"
+
+#include <Lotus/Common.h>
+
+#include <iostream>
+#include <atomic>
+
+using namespace lotus;
+
+// Loader threads add and remove items while a render thread reads a fixed set of live items every "frame", the same
+// access pattern as the content and d3d12 resource pools
+class EngineTest : public Test
+{
+public:
+    bool Init() override { return true; }
+
+    void Run() override
+    {
+        do
+        {
+            const f32 mutex_ms      = run_contention<mutex_pool>();
+            const f32 concurrent_ms = run_contention<concurrent_pool>();
+
+            std::cout << loader_count << " loader threads, " << read_count << " reads per frame\n";
+            std::cout << "  mutex free_list:      " << mutex_ms << " ms per frame\n";
+            std::cout << "  concurrent_free_list: " << concurrent_ms << " ms per frame\n";
+        } while (getchar() != 'q');
+    }
+
+    void Shutdown() override {}
+
+private:
+    struct item
+    {
+        u64 data[4];
+    };
+
+    struct mutex_pool
+    {
+        u32 add(const item& i)
+        {
+            std::lock_guard lock{ mutex };
+            return list.add(i);
+        }
+
+        void remove(u32 id)
+        {
+            std::lock_guard lock{ mutex };
+            list.remove(id);
+        }
+
+        u64 read(const u32* ids, u32 count)
+        {
+            std::lock_guard lock{ mutex };
+            u64             sum = 0;
+            for (u32 i = 0; i < count; ++i)
+            {
+                sum += list[ids[i]].data[0];
+            }
+            return sum;
+        }
+
+        utl::free_list<item> list;
+        std::mutex           mutex;
+    };
+
+    struct concurrent_pool
+    {
+        u32  add(const item& i) { return list.add(i); }
+        void remove(u32 id) { list.remove(id); }
+
+        u64 read(const u32* ids, u32 count)
+        {
+            u64 sum = 0;
+            for (u32 i = 0; i < count; ++i)
+            {
+                sum += list[ids[i]].data[0];
+            }
+            return sum;
+        }
+
+        utl::concurrent_free_list<item> list;
+    };
+
+    // Returns the average time the reader spent per frame
+    template<typename Pool>
+    f32 run_contention()
+    {
+        using clock = std::chrono::high_resolution_clock;
+
+        Pool             pool;
+        utl::vector<u32> read_ids;
+        for (u32 i = 0; i < read_count; ++i)
+        {
+            read_ids.emplace_back(pool.add(item{ { i, 0, 0, 0 } }));
+        }
+
+        std::atomic<bool> quit{ false };
+        std::thread       loaders[loader_count];
+        for (auto& loader : loaders)
+        {
+            loader = std::thread([&] {
+                utl::vector<u32> ids;
+                while (!quit)
+                {
+                    for (u32 i = 0; i < 64; ++i)
+                    {
+                        ids.emplace_back(pool.add(item{}));
+                    }
+                    for (const u32 id : ids)
+                    {
+                        pool.remove(id);
+                    }
+                    ids.clear();
+                }
+            });
+        }
+
+        u64        checksum = 0;
+        const auto start    = clock::now();
+        for (u32 frame = 0; frame < frame_count; ++frame)
+        {
+            checksum += pool.read(read_ids.data(), read_count);
+        }
+        const f32 ms = std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+
+        quit = true;
+        for (auto& loader : loaders)
+        {
+            loader.join();
+        }
+
+        for (const u32 id : read_ids)
+        {
+            pool.remove(id);
+        }
+
+        // Keeps the reads from being optimized out
+        if (checksum == 0)
+            std::cout << "";
+
+        return ms / (f32) frame_count;
+    }
+
+    constexpr static u32 loader_count = 4;
+    constexpr static u32 read_count   = 10000;
+    constexpr static u32 frame_count  = 1000;
+};
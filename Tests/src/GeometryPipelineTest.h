@@ -0,0 +1,201 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: GeometryPipelineTest.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Test.h"
+#include "../../ContentTools/src/Geometry.h"
+
+#include <iostream>
+#include <string>
+
+using namespace lotus;
+
+// Processes generated scenes of 5 LODs with 40 bumpy grid meshes each, every third one split over three materials, plus
+// one mesh large enough to be split into ranges and a fan whose center vertex is shared by 64K triangles. Times process_scene on one thread and on all of them, and checks that
+// pack_data gives the same bytes for both
+class EngineTest : public Test
+{
+public:
+    bool Init() override { return true; }
+
+    void Run() override
+    {
+        using clock = std::chrono::high_resolution_clock;
+        do
+        {
+            tools::scene_data serial{};
+            tools::scene_data parallel{};
+
+            auto      start     = clock::now();
+            const u64 triangles = process(serial, 1);
+            const f32 serial_ms = std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+
+            start = clock::now();
+            process(parallel, 0);
+            const f32 parallel_ms = std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+
+            const bool identical = serial.buffer_size == parallel.buffer_size &&
+                                   !memcmp(serial.buffer, parallel.buffer, serial.buffer_size);
+            CoTaskMemFree(serial.buffer);
+            CoTaskMemFree(parallel.buffer);
+
+            std::cout << triangles << " triangles\n";
+            std::cout << "  1 thread:      " << serial_ms << " ms, " << (f32) triangles / serial_ms / 1000.0f
+                      << " M triangles/s\n";
+            std::cout << "  all threads:   " << parallel_ms << " ms, " << (f32) triangles / parallel_ms / 1000.0f
+                      << " M triangles/s\n";
+            std::cout << "  packed output: " << (identical ? "identical" : "DIFFERENT") << "\n";
+        } while (getchar() != 'q');
+    }
+
+    void Shutdown() override {}
+
+private:
+    constexpr static u32 lod_count      = 5;
+    constexpr static u32 meshes_per_lod = 40;
+    constexpr static u32 grid_size      = 64;
+    constexpr static u32 large_size     = 300;
+    constexpr static u32 fan_spokes     = 64 * 1024;
+
+    // Generation isn't timed, only process_scene is
+    static u64 process(tools::scene_data& data, u32 max_threads)
+    {
+        tools::scene scene{ generate_scene() };
+        u64          triangles = 0;
+        for (auto& lod : scene.lod_groups)
+        {
+            for (auto& m : lod.meshes)
+            {
+                triangles += m.raw_indices.size() / 3;
+            }
+        }
+
+        data.settings                   = {};
+        data.settings.smoothing_angle   = 60.0f;
+        data.settings.calculate_normals = 1;
+        tools::process_scene(scene, data.settings, max_threads);
+        tools::pack_data(scene, data);
+        return triangles;
+    }
+
+    static tools::scene generate_scene()
+    {
+        tools::scene scene{};
+        scene.name = "generated scene";
+        for (u32 lod = 0; lod < lod_count; ++lod)
+        {
+            tools::lod_group& group = scene.lod_groups.emplace_back();
+            group.name              = "lod " + std::to_string(lod);
+            for (u32 i = 0; i < meshes_per_lod; ++i)
+            {
+                const u32    size = (grid_size >> lod) + (i % 5) * 3 + 2;
+                tools::mesh& m    = group.meshes.emplace_back(generate_grid(size, lod * 100 + i, i % 3 == 0));
+                m.lod_id          = lod;
+                m.lod_threshold   = (f32) lod;
+            }
+        }
+
+        scene.lod_groups[0].meshes.emplace_back(generate_grid(large_size, 999, true)).lod_id = 0;
+        scene.lod_groups[0].meshes.emplace_back(generate_fan(fan_spokes)).lod_id              = 0;
+        return scene;
+    }
+
+    // size x size quads over a bumpy surface, with a uv seam down the middle
+    static tools::mesh generate_grid(u32 size, u32 seed, bool split)
+    {
+        tools::mesh m{};
+        m.name = "grid " + std::to_string(seed);
+        m.uv_sets.resize(1);
+
+        for (u32 y = 0; y <= size; ++y)
+        {
+            for (u32 x = 0; x <= size; ++x)
+            {
+                const f32 fx = (f32) x / (f32) size;
+                const f32 fy = (f32) y / (f32) size;
+                m.positions.emplace_back(fx, std::sin(fx * 7.0f + (f32) seed) * std::cos(fy * 5.0f) * 0.1f, fy);
+            }
+        }
+
+        for (u32 y = 0; y < size; ++y)
+        {
+            for (u32 x = 0; x < size; ++x)
+            {
+                const u32 a = y * (size + 1) + x;
+                const u32 c = a + size + 1;
+                const u32 quad[6]{ a, c, a + 1, a + 1, c, c + 1 };
+                for (u32 k = 0; k < 6; ++k)
+                {
+                    const u32 v = quad[k];
+                    f32       u = (f32) (v % (size + 1)) / (f32) size;
+                    if (x == size / 2 && v % (size + 1) > x)
+                        u += 0.5f;
+                    m.raw_indices.emplace_back(v);
+                    m.uv_sets[0].emplace_back(u, (f32) (v / (size + 1)) / (f32) size);
+                }
+
+                const u32 material = split && (x + y * 3 + seed) % 3 == 0 ? 1 : 0;
+                m.material_indices.emplace_back(material);
+                m.material_indices.emplace_back(material);
+            }
+        }
+
+        // Material 2 has no polygons, so its submesh is dropped
+        m.material_used.emplace_back(0u);
+        if (split)
+        {
+            m.material_used.emplace_back(1u);
+            m.material_used.emplace_back(2u);
+        }
+        return m;
+    }
+
+    // A cone with jagged spokes, so the normals around the center only partly merge at 60 degrees
+    static tools::mesh generate_fan(u32 spokes)
+    {
+        tools::mesh m{};
+        m.name = "fan";
+        m.uv_sets.resize(1);
+
+        m.positions.emplace_back(0.0f, 1.0f, 0.0f);
+        for (u32 i = 0; i < spokes; ++i)
+        {
+            const f32 angle = math::two_pi * (f32) i / (f32) spokes;
+            m.positions.emplace_back(std::cos(angle), (f32) (i % 7) * 0.2f, std::sin(angle));
+        }
+
+        for (u32 i = 0; i < spokes; ++i)
+        {
+            const u32 tri[3]{ 0, (i + 1) % spokes + 1, i + 1 };
+            for (const u32 v : tri)
+            {
+                m.raw_indices.emplace_back(v);
+                m.uv_sets[0].emplace_back((f32) v / (f32) spokes, v ? 1.0f : 0.0f);
+            }
+            m.material_indices.emplace_back(0u);
+        }
+
+        m.material_used.emplace_back(0u);
+        return m;
+    }
+};
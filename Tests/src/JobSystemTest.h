@@ -0,0 +1,118 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: JobSystemTest.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Test.h"
+
+#include <Lotus/Core/JobSystem.h>
+
+#include <iostream>
+#include <thread>
+
+using namespace lotus;
+
+// Scheduling overhead: queueing and running many empty jobs. Scaling: the same parallel_for over a compute heavy loop
+// with 1, 2, 4, ... threads up to the hardware thread count
+class EngineTest : public Test
+{
+public:
+    bool Init() override
+    {
+        m_empty_jobs.resize(empty_job_count, jobs::job{ [](void*) {}, nullptr, &m_done, nullptr });
+        m_values.resize(value_count);
+        return true;
+    }
+
+    void Run() override
+    {
+        do
+        {
+            const u32 max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+            f32       single_ms   = 0.0f;
+
+            for (u32 threads = 1; threads <= max_threads; threads *= 2)
+            {
+                // Without initialize the jobs run on the calling thread, initialize(0) would start one per hardware thread
+                if (threads > 1)
+                    jobs::initialize(threads - 1);
+
+                const f32 overhead_ms = time_empty_jobs();
+                const f32 for_ms      = time_parallel_for();
+                if (threads == 1)
+                    single_ms = for_ms;
+
+                std::cout << threads << " threads: " << empty_job_count << " empty jobs " << overhead_ms << " ms ("
+                          << overhead_ms * 1'000'000.0f / empty_job_count << " ns each), parallel_for " << for_ms
+                          << " ms, speedup " << single_ms / for_ms << "\n";
+
+                jobs::shutdown();
+            }
+        } while (getchar() != 'q');
+    }
+
+    void Shutdown() override {}
+
+private:
+    using clock = std::chrono::high_resolution_clock;
+
+    f32 time_empty_jobs()
+    {
+        const auto start = clock::now();
+        for (u32 i = 0; i < empty_job_count; i += jobs_per_run)
+        {
+            jobs::run(&m_empty_jobs[i], jobs_per_run);
+        }
+        jobs::wait(m_done);
+        return ms_since(start);
+    }
+
+    f32 time_parallel_for()
+    {
+        const auto start = clock::now();
+        jobs::parallel_for(value_count, 1024, [this](u32 first, u32 last) {
+            for (u32 i = first; i < last; ++i)
+            {
+                f32 v = (f32) i;
+                for (u32 j = 0; j < 64; ++j)
+                {
+                    v = sqrtf(v * v + 1.0f);
+                }
+                m_values[i] = v;
+            }
+        });
+        return ms_since(start);
+    }
+
+    static f32 ms_since(clock::time_point start)
+    {
+        return std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+    }
+
+    constexpr static u32 empty_job_count = 1'000'000;
+    constexpr static u32 jobs_per_run    = 1000;
+    constexpr static u32 value_count     = 1'000'000;
+
+    jobs::counter          m_done{ 0 };
+    utl::vector<jobs::job> m_empty_jobs;
+    utl::vector<f32>       m_values;
+};
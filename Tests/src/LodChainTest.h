@@ -0,0 +1,119 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: LodChainTest.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Test.h"
+#include "../../ContentTools/src/Geometry.h"
+
+#include <iostream>
+#include <string>
+
+using namespace lotus;
+
+// Generates LODs for a bumpy grid with a uv seam down the middle and a second material on every third 16x16 block of
+// quads, diagonally, and prints the triangles, vertices and threshold of each one. The seam and the borders between the
+// materials have to survive
+class EngineTest : public Test
+{
+public:
+    bool Init() override { return true; }
+
+    void Run() override
+    {
+        using clock = std::chrono::high_resolution_clock;
+        do
+        {
+            tools::scene scene{};
+            scene.name = "generated scene";
+            tools::lod_group& group = scene.lod_groups.emplace_back();
+            group.name              = "grid";
+            group.meshes.emplace_back(generate_grid(grid_size)).lod_id = 0;
+
+            tools::geometry_import_settings settings{};
+            settings.smoothing_angle       = 60.0f;
+            settings.calculate_normals     = 1;
+            settings.optimize_vertex_cache = 1;
+            settings.generated_lods        = lod_count;
+
+            const auto start = clock::now();
+            tools::process_scene(scene, settings);
+            const f32 ms = std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+
+            std::cout << "process_scene: " << ms << " ms\n";
+            for (const auto& m : scene.lod_groups[0].meshes)
+            {
+                std::cout << "  " << m.name << ": LOD " << m.lod_id << ", threshold " << m.lod_threshold << ", "
+                          << m.indices.size() / 3 << " triangles, " << m.vertices.size() << " vertices\n";
+            }
+        } while (getchar() != 'q');
+    }
+
+    void Shutdown() override {}
+
+private:
+    constexpr static u32 grid_size = 256;
+    constexpr static u8  lod_count = 4;
+
+    static tools::mesh generate_grid(u32 size)
+    {
+        tools::mesh m{};
+        m.name = "grid";
+        m.uv_sets.resize(1);
+
+        for (u32 y = 0; y <= size; ++y)
+        {
+            for (u32 x = 0; x <= size; ++x)
+            {
+                const f32 fx = (f32) x / (f32) size;
+                const f32 fy = (f32) y / (f32) size;
+                m.positions.emplace_back(fx, std::sin(fx * 7.0f) * std::cos(fy * 5.0f) * 0.1f, fy);
+            }
+        }
+
+        for (u32 y = 0; y < size; ++y)
+        {
+            for (u32 x = 0; x < size; ++x)
+            {
+                const u32 a = y * (size + 1) + x;
+                const u32 c = a + size + 1;
+                const u32 quad[6]{ a, c, a + 1, a + 1, c, c + 1 };
+                for (const u32 v : quad)
+                {
+                    f32 u = (f32) (v % (size + 1)) / (f32) size;
+                    if (x == size / 2 && v % (size + 1) > x)
+                        u += 0.5f;
+                    m.raw_indices.emplace_back(v);
+                    m.uv_sets[0].emplace_back(u, (f32) (v / (size + 1)) / (f32) size);
+                }
+
+                const u32 material = (x / 16 + y / 16) % 3 == 0 ? 1 : 0;
+                m.material_indices.emplace_back(material);
+                m.material_indices.emplace_back(material);
+            }
+        }
+
+        m.material_used.emplace_back(0u);
+        m.material_used.emplace_back(1u);
+        return m;
+    }
+};
@@ -34,6 +34,36 @@
     #include "WindowTest.h"
 #elif TEST_RENDERER
     #include "TestRenderer.h"
+#elif TEST_SCRIPT_WRITES
+    #include "ScriptWritesTest.h"
+#elif TEST_FREE_LIST_CONTENTION
+    #include "FreeListContentionTest.h"
+#elif TEST_CHUNKED_VECTOR
+    #include "ChunkedVectorTest.h"
+#elif TEST_ENTITY_BATCH
+    #include "EntityBatchTest.h"
+#elif TEST_TRANSFORM_HIERARCHY
+    #include "TransformHierarchyTest.h"
+#elif TEST_TRANSFORM_CHANGES
+    #include "TransformChangesTest.h"
+#elif TEST_JOB_SYSTEM
+    #include "JobSystemTest.h"
+#elif TEST_SCRIPT_TICK
+    #include "ScriptTickTest.h"
+#elif TEST_SCRIPT_CHURN
+    #include "ScriptChurnTest.h"
+#elif TEST_SCRIPT_COROUTINE
+    #include "ScriptCoroutineTest.h"
+#elif TEST_SCRIPT_LOD
+    #include "ScriptLodTest.h"
+#elif TEST_SNAPSHOT
+    #include "SnapshotTest.h"
+#elif TEST_GEOMETRY_PIPELINE
+    #include "GeometryPipelineTest.h"
+#elif TEST_VERTEX_CACHE
+    #include "VertexCacheTest.h"
+#elif TEST_LOD_CHAIN
+    #include "LodChainTest.h"
 #else
     #error A test has not been enabled
 #endif
@@ -0,0 +1,132 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: ScriptChurnTest.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Test.h"
+
+#include <Lotus/Components/Entity.h>
+#include <Lotus/Components/Transform.h>
+#include <Lotus/Components/Script.h>
+
+#include <iostream>
+
+using namespace lotus;
+
+class churn_script : public script::entity_script
+{
+public:
+    constexpr explicit churn_script(game_entity::entity entity) : script::entity_script{ entity } {}
+
+    void update(f32 delta) override { m_time += delta; }
+
+private:
+    f32 m_time{};
+    f32 m_padding[7]{};
+};
+
+LOTUS_REGISTER_SCRIPT(churn_script);
+
+// Spawns and removes waves of scripted entities. Times the script allocations alone, one heap block per script the way
+// create_script used to allocate them against the pooled create_script, then whole waves through create_batch and
+// remove_batch. The allocation counts are the script memory tag's
+class EngineTest : public Test
+{
+public:
+    bool Init() override
+    {
+        m_script_info.script_creator = script::detail::get_script_creator(string_hash()("churn_script"));
+        m_infos.resize(wave_size);
+        for (u32 i = 0; i < wave_size; ++i)
+        {
+            m_infos[i] = { &m_transform_info, &m_script_info };
+        }
+        m_entities.resize(wave_size);
+        return true;
+    }
+
+    void Run() override
+    {
+        using clock = std::chrono::high_resolution_clock;
+        do
+        {
+            // Entity ids only have to be valid for the creators' asserts
+            const game_entity::entity dummy{ game_entity::entity_id{ 0 } };
+
+            u64  allocations = allocation_count();
+            auto start       = clock::now();
+            for (u32 wave = 0; wave < wave_count; ++wave)
+            {
+                utl::vector<scope<script::entity_script>> scripts;
+                scripts.reserve(wave_size);
+                for (u32 i = 0; i < wave_size; ++i)
+                {
+                    scripts.emplace_back(create_scope<churn_script>(dummy));
+                }
+            }
+            const f32 heap_ms = std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+
+            start = clock::now();
+            for (u32 wave = 0; wave < wave_count; ++wave)
+            {
+                utl::vector<script::detail::script_ptr> scripts;
+                scripts.reserve(wave_size);
+                for (u32 i = 0; i < wave_size; ++i)
+                {
+                    scripts.emplace_back(script::detail::create_script<churn_script>(dummy));
+                }
+            }
+            const f32 pool_ms          = std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+            const u64 pool_allocations = allocation_count() - allocations;
+
+            allocations = allocation_count();
+            start       = clock::now();
+            for (u32 wave = 0; wave < wave_count; ++wave)
+            {
+                game_entity::create_batch(m_infos.data(), wave_size, m_entities.data());
+                game_entity::remove_batch(m_entities.data(), wave_size);
+            }
+            const f32 entity_ms          = std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+            const u64 entity_allocations = allocation_count() - allocations;
+
+            std::cout << wave_count << " waves of " << wave_size << " scripts\n";
+            std::cout << "  heap per script:       " << heap_ms / (f32) wave_count << " ms per wave\n";
+            std::cout << "  pooled:                " << pool_ms / (f32) wave_count << " ms per wave, " << pool_allocations
+                      << " script allocations\n";
+            std::cout << "  entity create/remove:  " << entity_ms / (f32) wave_count << " ms per wave, "
+                      << entity_allocations << " script allocations\n";
+        } while (getchar() != 'q');
+    }
+
+    void Shutdown() override { script::shutdown(); }
+
+private:
+    constexpr static u32 wave_size  = 10'000;
+    constexpr static u32 wave_count = 100;
+
+    static u64 allocation_count() { return utl::get_memory_stats(utl::memory_tag::scripts).allocation_count; }
+
+    transform::create_info                m_transform_info{};
+    script::create_info                   m_script_info{};
+    utl::vector<game_entity::create_info> m_infos;
+    utl::vector<game_entity::entity>      m_entities;
+};
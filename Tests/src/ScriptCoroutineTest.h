@@ -0,0 +1,178 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: ScriptCoroutineTest.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Test.h"
+
+#include <Lotus/Components/Entity.h>
+#include <Lotus/Components/Transform.h>
+#include <Lotus/Components/Script.h>
+
+#include <iostream>
+
+using namespace lotus;
+
+// The first two scripts move their entity up once every few seconds and do nothing in between
+
+class polling_script : public script::entity_script
+{
+public:
+    constexpr explicit polling_script(game_entity::entity entity) : script::entity_script{ entity } {}
+
+    void update(f32 delta) override
+    {
+        m_timer += delta;
+        if (m_timer < interval)
+            return;
+
+        m_timer = 0.0f;
+        ++m_height;
+        set_position({ 0.0f, m_height, 0.0f });
+    }
+
+    constexpr static f32 interval = 3.0f;
+
+private:
+    f32 m_timer{};
+    f32 m_height{};
+};
+
+class waiting_script : public script::coroutine_script
+{
+public:
+    constexpr explicit waiting_script(game_entity::entity entity) : script::coroutine_script{ entity } {}
+
+    script::task run() override
+    {
+        for (f32 height = 1.0f;; ++height)
+        {
+            co_await script::wait_seconds(polling_script::interval);
+            set_position({ 0.0f, height, 0.0f });
+        }
+    }
+};
+
+// Removes its own entity from inside the coroutine, so the frame is still running when its script goes away
+class expiring_script : public script::coroutine_script
+{
+public:
+    constexpr explicit expiring_script(game_entity::entity entity) : script::coroutine_script{ entity } {}
+
+    script::task run() override
+    {
+        co_await script::wait_seconds(lifetime);
+        game_entity::remove(get_id());
+    }
+
+    constexpr static f32 lifetime = 0.5f;
+};
+
+LOTUS_REGISTER_SCRIPT(polling_script);
+LOTUS_REGISTER_SCRIPT(waiting_script);
+LOTUS_REGISTER_SCRIPT(expiring_script);
+
+// script_count entities with a script that is idle nearly every frame. Times update_all with the scripts polling a timer
+// in update, then with the same behaviour as coroutines waiting on the scheduler's timer wheel
+class EngineTest : public Test
+{
+public:
+    bool Init() override { return true; }
+
+    void Run() override
+    {
+        do
+        {
+            const f32 polling_ms = run_frames("polling_script");
+            const f32 waiting_ms = run_frames("waiting_script");
+
+            std::cout << script_count << " scripts acting every " << polling_script::interval << " seconds\n";
+            std::cout << "  update every frame:   " << polling_ms << " ms per frame\n";
+            std::cout << "  coroutine, wait:      " << waiting_ms << " ms per frame\n";
+            std::cout << "  (both include the transform update)\n";
+            std::cout << "  self removing coroutines: " << (run_expiring() ? "all removed" : "FAILED") << "\n";
+        } while (getchar() != 'q');
+    }
+
+    void Shutdown() override { script::shutdown(); }
+
+private:
+    constexpr static u32 script_count = 100'000;
+    constexpr static u32 frame_count  = 300;
+
+    f32 run_frames(const char* script_name)
+    {
+        using clock = std::chrono::high_resolution_clock;
+
+        transform::create_info                transform_info{};
+        script::create_info                   script_info{ script::detail::get_script_creator(string_hash()(script_name)) };
+        utl::vector<game_entity::create_info> infos(script_count);
+        for (u32 i = 0; i < script_count; ++i)
+        {
+            infos[i] = { &transform_info, &script_info };
+        }
+
+        utl::vector<game_entity::entity> entities(script_count);
+        game_entity::create_batch(infos.data(), script_count, entities.data());
+        // Starts the coroutines, which then wait
+        script::update_all(0.016f);
+
+        const auto start = clock::now();
+        for (u32 frame = 0; frame < frame_count; ++frame)
+        {
+            script::update_all(0.016f);
+        }
+        const f32 ms = std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+
+        game_entity::remove_batch(entities.data(), script_count);
+        return ms / (f32) frame_count;
+    }
+
+    // Every entity is removed by its own coroutine, true if none are left alive afterwards
+    static bool run_expiring()
+    {
+        constexpr u32 count = 1'000;
+
+        transform::create_info                transform_info{};
+        script::create_info                   script_info{ script::detail::get_script_creator(string_hash()("expiring_script")) };
+        utl::vector<game_entity::create_info> infos(count);
+        for (u32 i = 0; i < count; ++i)
+        {
+            infos[i] = { &transform_info, &script_info };
+        }
+
+        utl::vector<game_entity::entity> entities(count);
+        game_entity::create_batch(infos.data(), count, entities.data());
+
+        for (u32 frame = 0; frame < 60; ++frame)
+        {
+            script::update_all(0.016f);
+        }
+
+        bool all_removed = true;
+        for (const game_entity::entity& e : entities)
+        {
+            all_removed &= !game_entity::is_alive(e.get_id());
+        }
+        return all_removed;
+    }
+};
@@ -0,0 +1,143 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: ScriptLodTest.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Test.h"
+
+#include <Lotus/Components/Entity.h>
+#include <Lotus/Components/Transform.h>
+#include <Lotus/Components/Script.h>
+
+#include <iostream>
+
+using namespace lotus;
+
+// Stand in for background crowd logic, some math every update and a position write
+class crowd_script : public script::entity_script
+{
+public:
+    constexpr explicit crowd_script(game_entity::entity entity) : script::entity_script{ entity } {}
+
+    void update(f32 delta) override
+    {
+        m_time += delta;
+        f32 offset = 0.0f;
+        for (u32 i = 0; i < 32; ++i)
+        {
+            offset += std::sin(m_time + (f32) i) * 0.01f;
+        }
+        vec3 p = position();
+        p.y    = offset;
+        set_position(p);
+    }
+
+private:
+    f32 m_time{};
+};
+
+class crowd_lod_script : public crowd_script
+{
+public:
+    constexpr explicit crowd_lod_script(game_entity::entity entity) : crowd_script{ entity } {}
+
+    constexpr static script::update_policy policy{ script::update_policy::by_distance(25.0f, 200.0f, 16) };
+};
+
+LOTUS_REGISTER_SCRIPT(crowd_script);
+LOTUS_REGISTER_SCRIPT(crowd_lod_script);
+
+// script_count scripts on a grid around a camera entity at the origin. Times update_all with every script updated every
+// frame, then with a distance policy
+class EngineTest : public Test
+{
+public:
+    bool Init() override
+    {
+        transform::create_info camera_transform{};
+        m_camera = game_entity::create({ &camera_transform, nullptr });
+        script::set_active_camera(m_camera);
+        return true;
+    }
+
+    void Run() override
+    {
+        do
+        {
+            const f32 full_ms = run_frames("crowd_script");
+            const f32 lod_ms  = run_frames("crowd_lod_script");
+
+            std::cout << script_count << " crowd scripts on a " << grid_size << " x " << grid_size << " grid\n";
+            std::cout << "  every frame:   " << full_ms << " ms per frame\n";
+            std::cout << "  by distance:   " << lod_ms << " ms per frame\n";
+        } while (getchar() != 'q');
+    }
+
+    void Shutdown() override
+    {
+        script::set_active_camera({});
+        game_entity::remove(m_camera.get_id());
+        script::shutdown();
+    }
+
+private:
+    constexpr static u32 grid_size    = 316;
+    constexpr static u32 script_count = grid_size * grid_size;
+    constexpr static u32 frame_count  = 256;
+    constexpr static f32 spacing      = 1.5f;
+
+    f32 run_frames(const char* script_name)
+    {
+        using clock = std::chrono::high_resolution_clock;
+
+        script::create_info                   script_info{ script::detail::get_script_creator(string_hash()(script_name)) };
+        utl::vector<transform::create_info>   transforms(script_count);
+        utl::vector<game_entity::create_info> infos(script_count);
+        for (u32 i = 0; i < script_count; ++i)
+        {
+            transforms[i].position[0] = ((f32) (i % grid_size) - (f32) grid_size * 0.5f) * spacing;
+            transforms[i].position[2] = ((f32) (i / grid_size) - (f32) grid_size * 0.5f) * spacing;
+            infos[i]                  = { &transforms[i], &script_info };
+        }
+
+        utl::vector<game_entity::entity> entities(script_count);
+        game_entity::create_batch(infos.data(), script_count, entities.data());
+
+        // Lets the scripts settle into their buckets
+        for (u32 frame = 0; frame < script::max_update_interval; ++frame)
+        {
+            script::update_all(0.016f);
+        }
+
+        const auto start = clock::now();
+        for (u32 frame = 0; frame < frame_count; ++frame)
+        {
+            script::update_all(0.016f);
+        }
+        const f32 ms = std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+
+        game_entity::remove_batch(entities.data(), script_count);
+        return ms / (f32) frame_count;
+    }
+
+    game_entity::entity m_camera{};
+};
@@ -0,0 +1,138 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: ScriptTickTest.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Test.h"
+
+#include <Lotus/Components/Entity.h>
+#include <Lotus/Components/Transform.h>
+#include <Lotus/Components/Script.h>
+
+#include <iostream>
+
+using namespace lotus;
+
+// Scripts that only touch their own members, so the time measured is the cost of ticking them
+template<u32 N>
+class tick_script : public script::entity_script
+{
+public:
+    constexpr explicit tick_script(game_entity::entity entity) : script::entity_script{ entity } {}
+
+    void update(f32 delta) override
+    {
+        m_time += delta * (f32) (N + 1);
+        m_value = m_value * 0.5f + m_time;
+    }
+
+private:
+    f32 m_time{};
+    f32 m_value{};
+};
+
+using tick_script_a = tick_script<0>;
+using tick_script_b = tick_script<1>;
+using tick_script_c = tick_script<2>;
+using tick_script_d = tick_script<3>;
+LOTUS_REGISTER_SCRIPT(tick_script_a);
+LOTUS_REGISTER_SCRIPT(tick_script_b);
+LOTUS_REGISTER_SCRIPT(tick_script_c);
+LOTUS_REGISTER_SCRIPT(tick_script_d);
+
+// script_count scripts of four types created in interleaved order. Ticks them the way update_all used to, one virtual
+// call per script in creation order, then with update_all, which updates each type with its own loop
+class EngineTest : public Test
+{
+public:
+    bool Init() override
+    {
+        const char* const names[]{ "tick_script_a", "tick_script_b", "tick_script_c", "tick_script_d" };
+        script::create_info script_infos[std::size(names)];
+        for (u32 i = 0; i < std::size(names); ++i)
+        {
+            script_infos[i].script_creator = script::detail::get_script_creator(string_hash()(names[i]));
+        }
+
+        utl::vector<game_entity::create_info> infos(script_count);
+        for (u32 i = 0; i < script_count; ++i)
+        {
+            infos[i] = { &m_transform_info, &script_infos[(i * 7 + i / 3) % std::size(names)] };
+        }
+
+        m_entities.resize(script_count);
+        game_entity::create_batch(infos.data(), script_count, m_entities.data());
+
+        // Separate instances for the old style loop, created in the same order
+        for (u32 i = 0; i < script_count; ++i)
+        {
+            m_virtual_scripts.emplace_back(infos[i].script->script_creator(m_entities[i]));
+        }
+
+        return true;
+    }
+
+    void Run() override
+    {
+        using clock = std::chrono::high_resolution_clock;
+        do
+        {
+            auto start = clock::now();
+            for (u32 frame = 0; frame < frame_count; ++frame)
+            {
+                for (u32 i = 0; i < script_count; ++i)
+                {
+                    m_virtual_scripts[i]->update(0.016f);
+                }
+            }
+            const f32 virtual_ms = std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+
+            start = clock::now();
+            for (u32 frame = 0; frame < frame_count; ++frame)
+            {
+                script::update_all(0.016f);
+            }
+            const f32 grouped_ms = std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+
+            std::cout << script_count << " scripts, 4 types\n";
+            std::cout << "  virtual, creation order: " << virtual_ms / (f32) frame_count << " ms per frame\n";
+            std::cout << "  update_all, by type:     " << grouped_ms / (f32) frame_count
+                      << " ms per frame (includes the transform update)\n";
+        } while (getchar() != 'q');
+    }
+
+    void Shutdown() override
+    {
+        m_virtual_scripts.clear();
+        game_entity::remove_batch(m_entities.data(), script_count);
+        m_entities.clear();
+        script::shutdown();
+    }
+
+private:
+    constexpr static u32 script_count = 100'000;
+    constexpr static u32 frame_count  = 100;
+
+    transform::create_info                  m_transform_info{};
+    utl::vector<game_entity::entity>        m_entities;
+    utl::vector<script::detail::script_ptr> m_virtual_scripts;
+};
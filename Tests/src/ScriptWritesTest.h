@@ -0,0 +1,106 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: ScriptWritesTest.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "Test.h"
+
+#include <Lotus/Components/Entity.h>
+#include <Lotus/Components/Transform.h>
+#include <Lotus/Components/Script.h>
+
+#include <iostream>
+
+using namespace lotus;
+
+// Writes its entity's position every frame, so every script hits the transform cache lookup once per frame. Only moves
+// its own entity, so it can be updated in parallel
+class writer_script : public script::entity_script
+{
+public:
+    constexpr explicit writer_script(game_entity::entity entity) : script::entity_script{ entity } {}
+
+    constexpr static script::update_policy policy{ script::update_policy{}.in_parallel() };
+
+    void update(f32 delta) override
+    {
+        m_time += delta;
+        set_position({ m_time, 0.0f, 0.0f });
+    }
+
+private:
+    f32 m_time{};
+};
+LOTUS_REGISTER_SCRIPT(writer_script);
+
+class EngineTest : public Test
+{
+public:
+    bool Init() override
+    {
+        transform::create_info   transform_info{};
+        script::create_info      script_info{ script::detail::get_script_creator(string_hash()("writer_script")) };
+        game_entity::create_info entity_info{ &transform_info, &script_info };
+
+        for (u32 i = 0; i < writer_count; ++i)
+        {
+            game_entity::entity ent = game_entity::create(entity_info);
+            assert(ent.is_valid());
+            mEntities.push_back(ent);
+        }
+
+        return true;
+    }
+
+    void Run() override
+    {
+        using clock = std::chrono::high_resolution_clock;
+        do
+        {
+            const auto start = clock::now();
+            for (u32 i = 0; i < frame_count; ++i)
+            {
+                script::update_all(0.016f);
+            }
+            const f32 ms = std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+
+            std::cout << writer_count << " writer scripts: " << ms / (f32) frame_count << " ms per frame\n";
+        } while (getchar() != 'q');
+    }
+
+    void Shutdown() override
+    {
+        for (const auto& ent : mEntities)
+        {
+            game_entity::remove(ent.get_id());
+        }
+        mEntities.clear();
+        script::shutdown();
+    }
+
+private:
+    constexpr static u32 writer_count = 20000;
+    constexpr static u32 frame_count  = 100;
+
+    utl::vector<game_entity::entity> mEntities;
+};
@@ -0,0 +1,110 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: SnapshotTest.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Test.h"
+
+#include <Lotus/Components/Entity.h>
+#include <Lotus/Components/Transform.h>
+#include <Lotus/Components/Script.h>
+
+#include <iostream>
+
+using namespace lotus;
+
+class snapshot_script : public script::entity_script
+{
+public:
+    constexpr explicit snapshot_script(game_entity::entity entity) : script::entity_script{ entity } {}
+
+    void update(f32) override {}
+};
+
+LOTUS_REGISTER_SCRIPT(snapshot_script);
+
+// Builds a world of a million entities, one in eight with a script, and removes every third one so the snapshot has free
+// ids and bumped generations. Times saving it and loading it back over the same world, then checks every position
+class EngineTest : public Test
+{
+public:
+    bool Init() override
+    {
+        m_script_info.script_creator = script::detail::get_script_creator(string_hash()("snapshot_script"));
+
+        utl::vector<transform::create_info>   transform_infos(entity_count);
+        utl::vector<game_entity::create_info> infos(entity_count);
+        for (u32 i = 0; i < entity_count; ++i)
+        {
+            transform_infos[i].position[0] = (f32) i;
+            transform_infos[i].rotation[3] = 1.0f;
+            infos[i]                       = { &transform_infos[i], i % 8 ? nullptr : &m_script_info };
+        }
+
+        m_entities.resize(entity_count);
+        game_entity::create_batch(infos.data(), entity_count, m_entities.data());
+        for (u32 i = 0; i < entity_count; i += 3)
+        {
+            game_entity::remove(m_entities[i].get_id());
+        }
+        return true;
+    }
+
+    void Run() override
+    {
+        using clock = std::chrono::high_resolution_clock;
+        do
+        {
+            scope<u8[]> data{};
+            u64         size = 0;
+
+            auto       start   = clock::now();
+            const bool saved   = game_entity::save_snapshot(data, size);
+            const f32  save_ms = std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+
+            start              = clock::now();
+            const bool loaded  = saved && game_entity::load_snapshot(data.get(), size);
+            const f32  load_ms = std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+
+            u32 mismatches = 0;
+            for (u32 i = 0; i < entity_count; ++i)
+            {
+                const bool alive = game_entity::is_alive(m_entities[i].get_id());
+                if (alive != (i % 3 != 0) || (alive && m_entities[i].transform().position().x != (f32) i))
+                    ++mismatches;
+            }
+
+            std::cout << entity_count << " entities, " << size / (1024 * 1024) << " MB snapshot\n";
+            std::cout << "  save: " << save_ms << " ms" << (saved ? "" : " (failed)") << "\n";
+            std::cout << "  load: " << load_ms << " ms" << (loaded ? "" : " (failed)") << ", " << mismatches
+                      << " mismatches\n";
+        } while (getchar() != 'q');
+    }
+
+    void Shutdown() override { script::shutdown(); }
+
+private:
+    constexpr static u32 entity_count = 1'000'000;
+
+    script::create_info              m_script_info{};
+    utl::vector<game_entity::entity> m_entities;
+};
@@ -22,9 +22,24 @@
 // ------------------------------------------------------------------------------
 #pragma once
 
-#define TEST_ECS      0
-#define TEST_WINDOWS  0
-#define TEST_RENDERER 1
+#define TEST_ECS                  0
+#define TEST_WINDOWS              0
+#define TEST_RENDERER             1
+#define TEST_SCRIPT_WRITES        0
+#define TEST_FREE_LIST_CONTENTION 0
+#define TEST_CHUNKED_VECTOR       0
+#define TEST_ENTITY_BATCH         0
+#define TEST_TRANSFORM_HIERARCHY  0
+#define TEST_TRANSFORM_CHANGES    0
+#define TEST_JOB_SYSTEM           0
+#define TEST_SCRIPT_TICK          0
+#define TEST_SCRIPT_CHURN         0
+#define TEST_SCRIPT_COROUTINE     0
+#define TEST_SCRIPT_LOD           0
+#define TEST_SNAPSHOT             0
+#define TEST_GEOMETRY_PIPELINE    0
+#define TEST_VERTEX_CACHE         0
+#define TEST_LOD_CHAIN            0
 
 #include <thread>
 #include <chrono>
@@ -52,6 +67,8 @@ class timer_lt
     using time_stamp = std::chrono::steady_clock::time_point;
 
     constexpr f32 delta_average() const { return m_delta_average * 1e-6f; }
+    // Milliseconds the last frame took
+    constexpr f32 delta_last() const { return m_delta_last_ms; }
 
     void begin()
     {
@@ -61,6 +78,7 @@ class timer_lt
     void end()
     {
         auto dt = clock::now() - m_start;
+        m_delta_last_ms = std::chrono::duration<f32, std::milli>(dt).count();
         m_avg_us += ((f32)std::chrono::duration_cast<std::chrono::microseconds>(dt).count() - m_avg_us) / (f32)m_counter;
         ++m_counter;
         m_delta_average = m_avg_us;
@@ -81,6 +99,7 @@ class timer_lt
 private:
     f32 m_avg_us{0.0f};
     f32 m_delta_average{ 16.7f };
+    f32 m_delta_last_ms{ 16.7f };
     i32 m_counter{1};
 
     time_stamp m_start;
@@ -31,6 +31,7 @@
 #include "Lotus/Platform/Platform.h"
 #include "Lotus/Graphics/Renderer.h"
 #include "Lotus/Graphics/D3D12/D3D12Core.h"
+#include "Lotus/Graphics/Null/NullCore.h"
 
 #include "Lotus/Content/ContentToEngine.h"
 
@@ -45,6 +46,10 @@ using namespace lotus;
 
     // Multithreading
     #define ENABLE_TEST_WORKERS 0
+
+    // Runs the cpu side of every frame on the null renderer and logs the per stage timings
+    #define USE_NULL_RENDERER 0
+
 constexpr u32 num_threads     = 8;
 bool          should_shutdown = false;
 std::thread   workers[num_threads];
@@ -264,6 +269,49 @@ bool read_file(std::filesystem::path path, scope<u8[]>& data, u64& size)
     return true;
 }
 
+    #if USE_NULL_RENDERER
+void log_null_frame_timings()
+{
+    static graphics::null::frame_timings accumulated{};
+    static u32                           frame_count{ 0 };
+    static auto                          last_log{ std::chrono::steady_clock::now() };
+
+    const graphics::null::frame_timings& t{ graphics::null::core::last_frame_timings() };
+    accumulated.frame_setup += t.frame_setup;
+    accumulated.render_item_resolution += t.render_item_resolution;
+    accumulated.render_item_fetch += t.render_item_fetch;
+    accumulated.per_object_data += t.per_object_data;
+    accumulated.light_packing += t.light_packing;
+    accumulated.draw_submission += t.draw_submission;
+    accumulated.total += t.total;
+    ++frame_count;
+
+    if (std::chrono::steady_clock::now() - last_log < std::chrono::seconds(1))
+        return;
+
+    const f32   inv_count{ 1.0f / (f32) frame_count };
+    std::string msg{ "Null frame prep avg (ms): setup " + std::to_string(accumulated.frame_setup * inv_count) };
+    msg += " | resolve " + std::to_string(accumulated.render_item_resolution * inv_count);
+    msg += " | fetch " + std::to_string(accumulated.render_item_fetch * inv_count);
+    msg += " | per object " + std::to_string(accumulated.per_object_data * inv_count);
+    msg += " | lights " + std::to_string(accumulated.light_packing * inv_count);
+    msg += " | draws " + std::to_string(accumulated.draw_submission * inv_count);
+    msg += " | total " + std::to_string(accumulated.total * inv_count);
+    msg += " (" + std::to_string(t.render_item_count) + " items, " + std::to_string(t.draw_count) + " draws, " +
+           std::to_string(t.state_changes) + " state changes, " + std::to_string(t.bind_count) + " binds, checksum " +
+           std::to_string(t.bound_addresses) + ")";
+
+    const utl::linear_arena::statistics arena{ graphics::null::core::frame_arena().stats() };
+    msg += " | frame arena high water " + std::to_string(arena.high_water_mark) + " of " + std::to_string(arena.capacity) +
+           " bytes\n";
+    OutputDebugStringA(msg.c_str());
+
+    accumulated = {};
+    frame_count = 0;
+    last_log    = std::chrono::steady_clock::now();
+}
+    #endif
+
 bool test_initialize()
 {
     while (!compile_shaders())
@@ -272,8 +320,13 @@ bool test_initialize()
             return false;
     }
 
+    #if USE_NULL_RENDERER
+    if (!graphics::initialize(graphics::graphics_platform::null))
+        return false;
+    #else
     if (!graphics::initialize(graphics::graphics_platform::d3d12))
         return false;
+    #endif
 
     platform::window_create_info info[num_windows]{
         {&winproc, nullptr, L"Test Window 1", 100, 100, 400, 800},
@@ -324,6 +377,7 @@ void test_shutdown()
         destroy_camera_surface(s);
     }
 
+    script::shutdown();
     graphics::shutdown();
 }
 
@@ -350,10 +404,14 @@ void EngineTest::Run()
             info.render_item_count  = 3;
             info.thresholds         = &threshold;
             info.light_set_key      = 0;
+            info.last_frame_time    = timer.delta_last();
             info.average_frame_time = timer.delta_average();
             info.cam_id             = surfaces[i].camera.get_id();
 
             surfaces[i].surface.surface.render(info);
+    #if USE_NULL_RENDERER
+            log_null_frame_timings();
+    #endif
         }
     }
     timer.end();
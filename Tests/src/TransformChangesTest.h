@@ -0,0 +1,134 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: TransformChangesTest.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Test.h"
+
+#include <Lotus/Components/Entity.h>
+#include <Lotus/Components/Transform.h>
+
+#include <iostream>
+
+using namespace lotus;
+
+// A mostly static world: moved_count of entity_count transforms move every frame. Compares finding them by reading
+// the flags of every entity against iterating the published change list
+class EngineTest : public Test
+{
+public:
+    bool Init() override
+    {
+        m_transform_info.rotation[3] = 1.0f;
+        m_infos.resize(entity_count, game_entity::create_info{ &m_transform_info, nullptr });
+        m_entities.resize(entity_count);
+        m_ids.resize(entity_count);
+        m_flags.resize(entity_count);
+
+        game_entity::create_batch(m_infos.data(), entity_count, m_entities.data());
+        for (u32 i = 0; i < entity_count; ++i)
+        {
+            m_ids[i] = m_entities[i].get_id();
+        }
+        end_frame();
+        return true;
+    }
+
+    void Run() override
+    {
+        do
+        {
+            f32 scan_ms   = 0.0f;
+            f32 stream_ms = 0.0f;
+            u32 scan_found = 0, stream_found = 0;
+
+            for (u32 frame = 0; frame < frame_count; ++frame)
+            {
+                move_some(frame);
+                end_frame();
+
+                auto start = clock::now();
+                transform::get_updated_components_flags(m_ids.data(), entity_count, m_flags.data());
+                for (u32 i = 0; i < entity_count; ++i)
+                {
+                    if (m_flags[i])
+                        ++scan_found;
+                }
+                scan_ms += ms_since(start);
+
+                start = clock::now();
+                const transform::change* changes;
+                u32                      change_count;
+                transform::get_changes(changes, change_count);
+                for (u32 i = 0; i < change_count; ++i)
+                {
+                    if (changes[i].flags)
+                        ++stream_found;
+                }
+                stream_ms += ms_since(start);
+            }
+
+            std::cout << moved_count << " of " << entity_count << " transforms moving, " << frame_count << " frames\n";
+            std::cout << "  flag scan:     " << scan_ms << " ms, found " << scan_found << "\n";
+            std::cout << "  change stream: " << stream_ms << " ms, found " << stream_found << "\n";
+        } while (getchar() != 'q');
+    }
+
+    void Shutdown() override { game_entity::remove_batch(m_entities.data(), entity_count); }
+
+private:
+    using clock = std::chrono::high_resolution_clock;
+
+    void move_some(u32 frame)
+    {
+        transform::component_cache cache[moved_count]{};
+        for (u32 i = 0; i < moved_count; ++i)
+        {
+            const u32 index = (frame * moved_count + i * 97) % entity_count;
+            cache[i].id       = m_entities[index].transform().get_id();
+            cache[i].position = { (f32) frame, 0.0f, 0.0f };
+            cache[i].flags    = transform::component_flags::position;
+        }
+        transform::update(&cache[0], moved_count);
+    }
+
+    static void end_frame()
+    {
+        transform::update_matrices();
+        transform::publish_changes();
+    }
+
+    static f32 ms_since(clock::time_point start)
+    {
+        return std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+    }
+
+    constexpr static u32 entity_count = 100'000;
+    constexpr static u32 moved_count  = 100;
+    constexpr static u32 frame_count  = 100;
+
+    transform::create_info                m_transform_info{};
+    utl::vector<game_entity::create_info> m_infos;
+    utl::vector<game_entity::entity>      m_entities;
+    utl::vector<game_entity::entity_id>   m_ids;
+    utl::vector<u8>                       m_flags;
+};
@@ -0,0 +1,116 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: TransformHierarchyTest.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Test.h"
+
+#include <Lotus/Components/Entity.h>
+#include <Lotus/Components/Transform.h>
+
+#include <iostream>
+
+using namespace lotus;
+
+// Builds a wide hierarchy (binary tree) and a deep one (single chain) of node_count transforms, each one unit along x
+// from its parent, then times update_matrices after moving the root and after moving a single leaf
+class EngineTest : public Test
+{
+public:
+    bool Init() override
+    {
+        m_transform_info.position[0] = 1.0f;
+        m_transform_info.rotation[3] = 1.0f;
+        m_infos.resize(node_count, game_entity::create_info{ &m_transform_info, nullptr });
+        m_entities.resize(node_count);
+        return true;
+    }
+
+    void Run() override
+    {
+        do
+        {
+            run("wide:", [](u32 i) { return (i - 1) / 2; });
+            run("deep:", [](u32 i) { return i - 1; });
+        } while (getchar() != 'q');
+    }
+
+    void Shutdown() override {}
+
+private:
+    template<typename ParentOf>
+    void run(const char* name, ParentOf parent_of)
+    {
+        game_entity::create_batch(m_infos.data(), node_count, m_entities.data());
+        for (u32 i = 1; i < node_count; ++i)
+        {
+            transform::set_parent(m_entities[i].transform(), m_entities[parent_of(i)].transform());
+        }
+
+        const f32 build_ms = time_update();
+        move(0, 5.0f);
+        const f32 root_ms = time_update();
+        move(node_count - 1, 2.0f);
+        const f32 leaf_ms = time_update();
+
+        // The last node is parent_of-depth units from the root, plus the extra unit it was moved by
+        u32 depth = 0;
+        for (u32 i = node_count - 1; i; i = parent_of(i))
+        {
+            ++depth;
+        }
+
+        mat4 world, inverse_world;
+        transform::get_transform_matrices(m_entities[node_count - 1].get_id(), world, inverse_world);
+        const bool correct = std::abs(world._41 - (5.0f + (f32) depth + 1.0f)) < 0.01f * (f32) depth;
+
+        std::cout << name << " " << node_count << " nodes, depth " << depth << "\n";
+        std::cout << "  first update " << build_ms << " ms, root moved " << root_ms << " ms, leaf moved " << leaf_ms
+                  << " ms, leaf position " << (correct ? "correct" : "WRONG") << "\n";
+
+        game_entity::remove_batch(m_entities.data(), node_count);
+    }
+
+    void move(u32 node, f32 x)
+    {
+        transform::component_cache cache{};
+        cache.id       = m_entities[node].transform().get_id();
+        cache.position = { x, 0.0f, 0.0f };
+        cache.flags    = transform::component_flags::position;
+        transform::update(&cache, 1);
+    }
+
+    static f32 time_update()
+    {
+        using clock = std::chrono::high_resolution_clock;
+
+        const auto start = clock::now();
+        transform::update_matrices();
+        return std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+    }
+
+    constexpr static u32 node_count = 100'000;
+
+    transform::create_info                m_transform_info{};
+    utl::vector<game_entity::create_info> m_infos;
+    utl::vector<game_entity::entity>      m_entities;
+};
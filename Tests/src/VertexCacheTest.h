@@ -0,0 +1,134 @@
+// ------------------------------------------------------------------------------
+//
+// Lotus
+//    Copyright 2026 Matthew Rogers
+//
+//    Licensed under the Apache License, Version 2.0 (the "License");
+//    you may not use this file except in compliance with the License.
+//    You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+//    Unless required by applicable law or agreed to in writing, software
+//    distributed under the License is distributed on an "AS IS" BASIS,
+//    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//    See the License for the specific language governing permissions and
+//    limitations under the License.
+//
+// File Name: VertexCacheTest.h
+// Date File Created: 10/17/2026
+// Author: Matt
+//
+// ------------------------------------------------------------------------------
+#pragma once
+
+#include "Test.h"
+#include "../../ContentTools/src/Geometry.h"
+
+#include <iostream>
+#include <string>
+
+using namespace lotus;
+
+// Processes a bumpy grid whose triangles are shuffled, like an exporter that doesn't care about draw order, once as is,
+// once reordered for the vertex cache and once also for overdraw. Prints the time and the ACMR/ATVR of each
+class EngineTest : public Test
+{
+public:
+    bool Init() override { return true; }
+
+    void Run() override
+    {
+        do
+        {
+            run("as imported:      ", 0, 0);
+            run("vertex cache:     ", 1, 0);
+            run("cache + overdraw: ", 1, 1);
+        } while (getchar() != 'q');
+    }
+
+    void Shutdown() override {}
+
+private:
+    constexpr static u32 grid_size = 512;
+
+    static void run(const char* name, u8 cache, u8 overdraw)
+    {
+        using clock = std::chrono::high_resolution_clock;
+
+        tools::scene scene{};
+        scene.name = "generated scene";
+        tools::lod_group& group = scene.lod_groups.emplace_back();
+        group.name              = "lod 0";
+        group.meshes.emplace_back(generate_shuffled_grid(grid_size));
+
+        tools::geometry_import_settings settings{};
+        settings.smoothing_angle       = 60.0f;
+        settings.calculate_normals     = 1;
+        settings.optimize_vertex_cache = cache;
+        settings.optimize_overdraw     = overdraw;
+
+        const auto start = clock::now();
+        tools::process_scene(scene, settings);
+        const f32 ms = std::chrono::duration<f32, std::milli>(clock::now() - start).count();
+
+        const tools::mesh& m = scene.lod_groups[0].meshes[0];
+        std::cout << name << ms << " ms, " << m.vertices.size() << " vertices";
+        if (cache)
+        {
+            const tools::vertex_cache_stats& stats = m.cache_stats;
+            std::cout << ", ACMR " << stats.acmr_before << " -> " << stats.acmr_after << ", ATVR " << stats.atvr_before
+                      << " -> " << stats.atvr_after;
+        }
+        std::cout << "\n";
+    }
+
+    static tools::mesh generate_shuffled_grid(u32 size)
+    {
+        tools::mesh m{};
+        m.name = "shuffled grid";
+        m.uv_sets.resize(1);
+
+        for (u32 y = 0; y <= size; ++y)
+        {
+            for (u32 x = 0; x <= size; ++x)
+            {
+                const f32 fx = (f32) x / (f32) size;
+                const f32 fy = (f32) y / (f32) size;
+                m.positions.emplace_back(fx, std::sin(fx * 7.0f) * std::cos(fy * 5.0f) * 0.1f, fy);
+            }
+        }
+
+        const u32        num_triangles = size * size * 2;
+        utl::vector<u32> triangles(num_triangles);
+        for (u32 t = 0; t < num_triangles; ++t)
+        {
+            triangles[t] = t;
+        }
+
+        // Fisher-Yates with a fixed seed, so every run draws the same order
+        u32 seed = 12345;
+        for (u32 t = num_triangles - 1; t > 0; --t)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            std::swap(triangles[t], triangles[seed % (t + 1)]);
+        }
+
+        for (const u32 t : triangles)
+        {
+            const u32 quad = t / 2;
+            const u32 a    = (quad / size) * (size + 1) + quad % size;
+            const u32 c    = a + size + 1;
+            const u32 tri[2][3]{ { a, c, a + 1 }, { a + 1, c, c + 1 } };
+            for (const u32 v : tri[t % 2])
+            {
+                m.raw_indices.emplace_back(v);
+                m.uv_sets[0].emplace_back((f32) (v % (size + 1)) / (f32) size, (f32) (v / (size + 1)) / (f32) size);
+            }
+            m.material_indices.emplace_back(0u);
+        }
+
+        m.material_used.emplace_back(0u);
+        return m;
+    }
+};